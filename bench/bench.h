@@ -0,0 +1,56 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef BENCH_BENCH_H
+#define BENCH_BENCH_H
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace bench {
+
+    // runs fn once and returns the elapsed wall clock time in milliseconds
+    template<typename _Fn>
+    double time_ms(_Fn&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(stop - start).count();
+    }
+
+    // the fastest of a few runs, so the first run doesn't pay alone for faulting in fresh memory
+    template<typename _Fn>
+    double best_ms(std::size_t runs, _Fn&& fn) {
+        double best = time_ms(fn);
+        for (std::size_t i = 1; i < runs; ++i) {
+            double ms = time_ms(fn);
+            best = ms < best ? ms : best;
+        }
+        return best;
+    }
+
+    inline void report(const std::string& name, double ms) {
+        std::cout << std::left << std::setw(48) << name << std::right << std::setw(12)
+                  << std::fixed << std::setprecision(3) << ms << " ms\n";
+    }
+
+    // the problem size can be passed as the first command line argument
+    inline std::size_t size_arg(int argc, char** argv, std::size_t fallback) {
+        return argc > 1 ? std::strtoull(argv[1], nullptr, 10) : fallback;
+    }
+
+    template<typename _V>
+    inline volatile _V sink{};
+
+    // keeps the optimizer from throwing away the benchmarked work
+    template<typename _V>
+    inline void do_not_optimize(const _V& value) {
+        sink<_V> = value;
+    }
+}
+
+#endif //BENCH_BENCH_H
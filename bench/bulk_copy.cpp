@@ -0,0 +1,45 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <vector>
+
+#include "bench.h"
+#include "forward_list.h"
+#include "list.h"
+
+// copying a list element by element with push_back against the copy constructor, which builds
+// all the nodes in one block. The copies are destroyed inside the timing
+template<typename _L>
+void copy(const std::string& name, std::size_t n) {
+    _L original;
+    for (std::size_t i = 0; i < n; ++i) {
+        original.push_front(i);
+    }
+
+    bench::report(name + " push_back per element", bench::best_ms(3, [&original]() {
+        _L copy;
+        for (auto value : original) {
+            copy.push_back(value);
+        }
+        bench::do_not_optimize(copy.size());
+    }));
+
+    bench::report(name + " copy constructor", bench::best_ms(3, [&original]() {
+        _L copy(original);
+        bench::do_not_optimize(copy.size());
+    }));
+
+    std::vector<std::size_t> values(original.begin(), original.end());
+    bench::report(name + " from a vector", bench::best_ms(3, [&values]() {
+        _L copy(values.begin(), values.end());
+        bench::do_not_optimize(copy.size());
+    }));
+}
+
+int main(int argc, char** argv) {
+    auto n = bench::size_arg(argc, argv, 10'000'000);
+    copy<saxion::forward_list<std::size_t>>("forward_list", n);
+    copy<saxion::list<std::size_t>>("list", n);
+    return 0;
+}
@@ -0,0 +1,58 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <random>
+#include <vector>
+
+#include "bench.h"
+#include "list.h"
+
+// a traversal of a freshly built list, of the same list after churn (insertions and erasures at random
+// positions scatter the nodes over the heap) and of that list after defragment()
+template<typename _L>
+double traverse(const _L& lst, std::size_t rounds) {
+    return bench::time_ms([&lst, rounds]() {
+        std::size_t sum = 0;
+        for (std::size_t r = 0; r < rounds; ++r) {
+            for (auto value : lst) {
+                sum += value;
+            }
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+
+int main(int argc, char** argv) {
+    auto n = bench::size_arg(argc, argv, 1'000'000);
+    const std::size_t rounds = 10;
+    std::mt19937_64 random(42);
+
+    saxion::list<std::size_t> fresh;
+    for (std::size_t i = 0; i < n; ++i) {
+        fresh.push_back(i);
+    }
+    bench::report("fresh list", traverse(fresh, rounds));
+
+    // every insertion goes before a random element, every third round a random element is erased
+    saxion::list<std::size_t> churned;
+    std::vector<saxion::list<std::size_t>::iterator> positions;
+    positions.push_back(churned.insert(churned.end(), 0));
+    for (std::size_t round = 1; churned.size() < n; ++round) {
+        std::uniform_int_distribution<std::size_t> pick(0, positions.size() - 1);
+        positions.push_back(churned.insert(positions[pick(random)], positions.size()));
+        if (round % 3 == 0) {
+            std::size_t victim = pick(random);
+            churned.erase(positions[victim]);
+            positions[victim] = positions.back();
+            positions.pop_back();
+        }
+    }
+    bench::report("list after churn", traverse(churned, rounds));
+
+    bench::report("defragment()", bench::time_ms([&churned]() {
+        churned.defragment();
+    }));
+    bench::report("list after defragment()", traverse(churned, rounds));
+    return 0;
+}
@@ -0,0 +1,44 @@
+//
+// Created by Saxion ACS.
+//
+
+#include "bench.h"
+#include "deque.h"
+#include "list.h"
+
+// FIFO workloads: a queue that is filled and drained, and a queue that stays at a steady length
+template<typename _Q>
+void fifo(const std::string& name, std::size_t n) {
+    bench::report(name + " fill + drain", bench::time_ms([n]() {
+        _Q queue;
+        for (std::size_t i = 0; i < n; ++i) {
+            queue.push_back(i);
+        }
+        std::size_t sum = 0;
+        while (!queue.empty()) {
+            sum += queue.front();
+            queue.pop_front();
+        }
+        bench::do_not_optimize(sum);
+    }));
+
+    bench::report(name + " steady queue of 1000", bench::time_ms([n]() {
+        _Q queue;
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            queue.push_back(i);
+            if (queue.size() > 1000) {
+                sum += queue.front();
+                queue.pop_front();
+            }
+        }
+        bench::do_not_optimize(sum);
+    }));
+}
+
+int main(int argc, char** argv) {
+    auto n = bench::size_arg(argc, argv, 10'000'000);
+    std::cout << "FIFO workloads, " << n << " elements\n";
+    fifo<saxion::list<std::size_t>>("saxion::list", n);
+    fifo<saxion::deque<std::size_t>>("saxion::deque", n);
+}
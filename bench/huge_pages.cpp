@@ -0,0 +1,139 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "list.h"
+#include "list_nodes.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// the dTLB load misses of this process, when the kernel lets us count them
+class dtlb_counter {
+public:
+    dtlb_counter() : _fd(-1) {
+#if defined(__linux__)
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8u) |
+                      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16u);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        _fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~dtlb_counter() {
+#if defined(__linux__)
+        if (_fd >= 0) close(_fd);
+#endif
+    }
+
+    void start() {
+#if defined(__linux__)
+        if (_fd >= 0) {
+            ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    // -1 when the misses can't be counted
+    long long stop() {
+        long long count = -1;
+#if defined(__linux__)
+        if (_fd >= 0) {
+            ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(_fd, &count, sizeof(count)) != sizeof(count)) count = -1;
+        }
+#endif
+        return count;
+    }
+
+private:
+    int _fd;
+};
+
+// the huge pages the kernel actually gave this process
+std::string anon_huge_pages() {
+    std::ifstream smaps("/proc/self/smaps_rollup");
+    std::string line;
+    while (std::getline(smaps, line)) {
+        if (line.rfind("AnonHugePages:", 0) == 0) return line.substr(14);
+    }
+    return " n/a";
+}
+
+// the elements are inserted before random elements, so a traversal jumps all over the nodes:
+// the access pattern of a list that was built up over time
+template<typename _Nd>
+void traversal(const std::string& name, std::size_t n, std::size_t rounds) {
+    saxion::list<std::size_t, saxion::eager_size, _Nd> lst;
+    std::vector<typename decltype(lst)::iterator> positions;
+    positions.reserve(n);
+    std::mt19937_64 random(42);
+    positions.push_back(lst.insert(lst.end(), 0));
+    for (std::size_t i = 1; i < n; ++i) {
+        std::uniform_int_distribution<std::size_t> pick(0, positions.size() - 1);
+        positions.push_back(lst.insert(positions[pick(random)], i));
+    }
+    positions = {};
+
+    dtlb_counter misses;
+    misses.start();
+    double ms = bench::time_ms([&lst, rounds]() {
+        std::size_t sum = 0;
+        for (std::size_t r = 0; r < rounds; ++r) {
+            for (auto value : lst) sum += value;
+        }
+        bench::do_not_optimize(sum);
+    });
+    long long count = misses.stop();
+    bench::report(name + " traversal", ms);
+    if (count >= 0) {
+        std::cout << "    dTLB load misses per node: " << static_cast<double>(count) / static_cast<double>(n * rounds)
+                  << "\n";
+    } else {
+        std::cout << "    dTLB load misses: not available (perf_event_open refused)\n";
+    }
+    std::cout << "    AnonHugePages:" << anon_huge_pages() << "\n";
+}
+
+// the cost of the node memory alone: n push_backs and the frees of clear(), per node
+template<typename _Nd>
+void allocation(const std::string& name, std::size_t n) {
+    saxion::list<std::size_t, saxion::eager_size, _Nd> lst;
+    double ms = bench::best_ms(3, [&lst, n]() {
+        for (std::size_t i = 0; i < n; ++i) lst.push_back(i);
+        lst.clear();
+    });
+    bench::report(name + " push_back + clear", ms);
+    std::cout << "    ns per node: " << ms * 1e6 / static_cast<double>(n) << "\n";
+}
+
+int main(int argc, char** argv) {
+    auto n = bench::size_arg(argc, argv, 10'000'000);
+    const std::size_t rounds = 3;
+
+    using huge_node = saxion::huge_page_node<std::size_t>;
+    allocation<saxion::detail::list_node_t<std::size_t>>("heap nodes", n);
+    allocation<huge_node>("huge page nodes", n);
+    traversal<saxion::detail::list_node_t<std::size_t>>("heap nodes", n, rounds);
+    traversal<huge_node>("huge page nodes", n, rounds);
+    std::cout << "huge pages granted by madvise: " << std::boolalpha
+              << saxion::huge_page_arena::of<huge_node>().huge_pages() << "\n";
+    return 0;
+}
@@ -0,0 +1,86 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <array>
+#include <vector>
+#include <string>
+
+#include "bench.h"
+#include "list_nodes.h"
+
+// keyed lookups in a list: a linear find with the plain node against the nodes of list_nodes.h
+// the strings share a long prefix, so comparing two of them is expensive and mostly fails late
+
+struct record {
+    std::array<char, 240> payload;
+    int id;
+};
+
+struct by_id {
+    int operator()(const record& r) const noexcept {
+        return r.id;
+    }
+};
+
+static std::string name_of(std::size_t i) {
+    return std::string(48, 'x') + std::to_string(i);
+}
+
+template<typename _List>
+void string_lookups(const std::string& name, std::size_t n, std::size_t lookups) {
+    _List lst;
+    for (std::size_t i = 0; i < n; ++i) {
+        lst.push_back(name_of(i));
+    }
+    std::vector<std::string> keys;
+    for (std::size_t i = 0; i < lookups; ++i) {
+        keys.push_back(name_of((i * 7919) % n));
+    }
+    bench::report(name, bench::time_ms([&]() {
+        std::size_t found = 0;
+        for (auto& key : keys) {
+            found += lst.find(key) != lst.end();
+        }
+        bench::do_not_optimize(found);
+    }));
+}
+
+template<typename _List, typename _Find>
+void record_lookups(const std::string& name, std::size_t n, std::size_t lookups, _Find find) {
+    _List lst;
+    for (std::size_t i = 0; i < n; ++i) {
+        lst.push_back(record{{}, static_cast<int>(i)});
+    }
+    bench::report(name, bench::time_ms([&]() {
+        std::size_t found = 0;
+        for (std::size_t i = 0; i < lookups; ++i) {
+            found += find(lst, static_cast<int>((i * 7919) % n));
+        }
+        bench::do_not_optimize(found);
+    }));
+}
+
+int main(int argc, char** argv) {
+    auto n = bench::size_arg(argc, argv, 10'000);
+    std::size_t lookups = 2'000;
+    std::cout << "keyed lookups, " << lookups << " finds in " << n << " elements\n";
+
+    string_lookups<saxion::list<std::string>>("string, plain node", n, lookups);
+    string_lookups<saxion::list<std::string, saxion::eager_size, saxion::cached_hash_node<std::string>>>(
+            "string, cached_hash_node", n, lookups);
+    string_lookups<saxion::forward_list<std::string>>("forward string, plain node", n, lookups);
+    string_lookups<saxion::forward_list<std::string, saxion::eager_size,
+            saxion::forward_cached_hash_node<std::string>>>("forward string, cached_hash_node", n, lookups);
+
+    record_lookups<saxion::list<record>>("record, plain node + find_if", n, lookups, [](auto& lst, int id) {
+        for (auto& r : lst) {
+            if (r.id == id) return true;
+        }
+        return false;
+    });
+    record_lookups<saxion::list<record, saxion::eager_size, saxion::key_node<record, by_id>>>(
+            "record, key_node", n, lookups, [](auto& lst, int id) {
+                return lst.find(id) != lst.end();
+            });
+}
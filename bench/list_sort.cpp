@@ -0,0 +1,65 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "list.h"
+
+// sorting a list in place with list::sort(), which only relinks the nodes, against copying the values
+// into a vector, sorting that and building the list again. Once for plain numbers and once for
+// strings, which the rebuild has to copy
+template<typename _T>
+void sort(const std::string& name, const std::vector<_T>& values) {
+    double rebuild = 0;
+    double relink = 0;
+    for (int run = 0; run < 3; ++run) {
+        {
+            saxion::list<_T> lst;
+            for (const auto& value : values) {
+                lst.push_back(value);
+            }
+            double ms = bench::time_ms([&lst]() {
+                std::vector<_T> copy(lst.begin(), lst.end());
+                std::sort(copy.begin(), copy.end());
+                lst.assign(copy.begin(), copy.end());
+            });
+            rebuild = run == 0 || ms < rebuild ? ms : rebuild;
+            bench::do_not_optimize(lst.size());
+        }
+        {
+            saxion::list<_T> lst;
+            for (const auto& value : values) {
+                lst.push_back(value);
+            }
+            double ms = bench::time_ms([&lst]() { lst.sort(); });
+            relink = run == 0 || ms < relink ? ms : relink;
+            bench::do_not_optimize(lst.size());
+        }
+    }
+    bench::report(name + " copy, std::sort, rebuild", rebuild);
+    bench::report(name + " list::sort", relink);
+}
+
+int main(int argc, char** argv) {
+    auto n = bench::size_arg(argc, argv, 10'000'000);
+    std::mt19937_64 gen(7);
+    std::vector<std::uint64_t> numbers(n);
+    for (auto& number : numbers) {
+        number = gen();
+    }
+    sort("uint64", numbers);
+
+    std::vector<std::string> strings;
+    strings.reserve(n / 4);
+    for (std::size_t i = 0; i < n / 4; ++i) {
+        strings.push_back("a string that doesn't fit in the small buffer " + std::to_string(numbers[i]));
+    }
+    sort("string (n / 4)", strings);
+    return 0;
+}
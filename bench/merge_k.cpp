@@ -0,0 +1,91 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "bench.h"
+#include "forward_list.h"
+
+// merging k sorted forward_lists of n / k random numbers each: merge_k() relinks the nodes, picking
+// the next one with a loser tree, against a std::priority_queue of the heads that copies the values
+// into a new list
+void merge(std::size_t n, std::size_t k) {
+    std::mt19937_64 gen(k);
+    std::vector<std::vector<std::uint64_t>> sources(k);
+    for (auto& source : sources) {
+        source.resize(n / k);
+        for (auto& value : source) {
+            value = gen();
+        }
+        std::sort(source.begin(), source.end());
+    }
+    auto make_lists = [&sources]() {
+        std::vector<saxion::forward_list<std::uint64_t>> lists(sources.size());
+        for (std::size_t i = 0; i < sources.size(); ++i) {
+            for (auto value : sources[i]) {
+                lists[i].push_back(value);
+            }
+        }
+        return lists;
+    };
+
+    double tree = 0;
+    double heap = 0;
+    for (int run = 0; run < 3; ++run) {
+        {
+            auto lists = make_lists();
+            double ms = bench::time_ms([&lists]() {
+                auto merged = saxion::merge_k(lists.begin(), lists.end());
+                bench::do_not_optimize(merged.front());
+                merged.detach_and_reclaim();
+            });
+            tree = run == 0 || ms < tree ? ms : tree;
+        }
+        {
+            auto lists = make_lists();
+            double ms = bench::time_ms([&lists]() {
+                using head = std::pair<std::uint64_t, std::size_t>;
+                using iterator = saxion::forward_list<std::uint64_t>::iterator;
+                std::vector<iterator> positions;
+                std::priority_queue<head, std::vector<head>, std::greater<>> heads;
+                for (std::size_t i = 0; i < lists.size(); ++i) {
+                    positions.push_back(lists[i].begin());
+                    if (positions[i] != lists[i].end()) {
+                        heads.push({*positions[i], i});
+                    }
+                }
+                saxion::forward_list<std::uint64_t> merged;
+                while (!heads.empty()) {
+                    auto [value, i] = heads.top();
+                    heads.pop();
+                    merged.push_back(value);
+                    if (++positions[i] != lists[i].end()) {
+                        heads.push({*positions[i], i});
+                    }
+                }
+                bench::do_not_optimize(merged.front());
+                merged.detach_and_reclaim();
+            });
+            heap = run == 0 || ms < heap ? ms : heap;
+        }
+        saxion::reclaimer::instance().flush();
+    }
+    auto name = "k = " + std::to_string(k);
+    bench::report(name + " merge_k", tree);
+    bench::report(name + " priority_queue and copies", heap);
+}
+
+int main(int argc, char** argv) {
+    auto n = bench::size_arg(argc, argv, 10'000'000);
+    for (std::size_t k = 16; k <= 1024; k *= 4) {
+        merge(n, k);
+    }
+    return 0;
+}
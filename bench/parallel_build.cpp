@@ -0,0 +1,49 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "bench.h"
+#include "parallel.h"
+
+namespace {
+    // a little work per element, like parsing a record of the input
+    std::uint64_t mix(std::uint64_t value) {
+        value ^= value >> 33u;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33u;
+        value *= 0xc4ceb9fe1a85ec53ULL;
+        return value ^ (value >> 33u);
+    }
+}
+
+// a forward_list of mixed numbers from a vector, with push_back and with parallel_build() on 1, 2, 4, ...
+// threads, up to the number of cores (or the second command line argument)
+int main(int argc, char** argv) {
+    auto n = bench::size_arg(argc, argv, 20'000'000);
+    std::size_t max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : saxion::default_threads();
+    std::vector<std::uint64_t> input(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        input[i] = i;
+    }
+
+    double ms = bench::best_ms(3, [&input]() {
+        saxion::forward_list<std::uint64_t> lst;
+        for (auto value : input) {
+            lst.push_back(mix(value));
+        }
+        bench::do_not_optimize(lst.back());
+    });
+    bench::report("push_back", ms);
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        ms = bench::best_ms(3, [&input, threads]() {
+            auto lst = saxion::parallel_build(input, mix, threads);
+            bench::do_not_optimize(lst.back());
+        });
+        bench::report("parallel_build, " + std::to_string(threads) + " threads", ms);
+    }
+    return 0;
+}
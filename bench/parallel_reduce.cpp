@@ -0,0 +1,52 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "bench.h"
+#include "parallel.h"
+
+namespace {
+    // a few hundred nanoseconds of arithmetic per element, so the work and not the traversal counts
+    double heavy(double value) {
+        for (int i = 0; i < 64; ++i) {
+            value = std::sqrt(value * value + 1.0) * 0.999;
+        }
+        return value;
+    }
+}
+
+// parallel_transform_reduce() and parallel_for_each() with work that is expensive per element,
+// with 1, 2, 4, ... threads, up to the number of cores (or the second command line argument).
+// The last line is the cost of partition_points() alone
+int main(int argc, char** argv) {
+    auto n = bench::size_arg(argc, argv, 2'000'000);
+    std::size_t max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : saxion::default_threads();
+    saxion::list<double> lst;
+    for (std::size_t i = 0; i < n; ++i) {
+        lst.push_back(static_cast<double>(i % 1000));
+    }
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        double ms = bench::best_ms(3, [&lst, threads]() {
+            bench::do_not_optimize(saxion::parallel_transform_reduce(lst, 0.0, std::plus<>(), heavy, threads));
+        });
+        bench::report("transform_reduce, " + std::to_string(threads) + " threads", ms);
+    }
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        double ms = bench::best_ms(3, [&lst, threads]() {
+            saxion::parallel_for_each(lst, [](double& value) { value = heavy(value); }, threads);
+        });
+        bench::do_not_optimize(lst.front());
+        bench::report("for_each, " + std::to_string(threads) + " threads", ms);
+    }
+    double ms = bench::best_ms(3, [&lst, max_threads]() {
+        bench::do_not_optimize(lst.partition_points(max_threads * 8).size());
+    });
+    bench::report("partition_points", ms);
+    return 0;
+}
@@ -0,0 +1,32 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "bench.h"
+#include "parallel.h"
+
+// parallel_sort() of a list of random numbers with 1, 2, 4, ... threads, up to the number of cores
+// (or the second command line argument)
+int main(int argc, char** argv) {
+    auto n = bench::size_arg(argc, argv, 10'000'000);
+    std::size_t max_threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : saxion::default_threads();
+    std::mt19937_64 gen(13);
+    std::vector<std::uint64_t> values(n);
+    for (auto& value : values) {
+        value = gen();
+    }
+
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        // one block in list order, so every run starts from the same memory layout: nodes from push_back
+        // would reuse the scattered memory of the list the run before sorted
+        saxion::list<std::uint64_t> lst(values.begin(), values.end());
+        double ms = bench::time_ms([&lst, threads]() { saxion::parallel_sort(lst, std::less<>(), threads); });
+        bench::do_not_optimize(lst.front());
+        bench::report("parallel_sort, " + std::to_string(threads) + " threads", ms);
+    }
+    return 0;
+}
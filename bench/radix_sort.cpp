@@ -0,0 +1,70 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "bench.h"
+#include "forward_list.h"
+#include "list.h"
+
+// sorting a forward_list of random 64 bit numbers with radix_sort(), which deals the nodes out over
+// buckets, against copying the values into a vector, sorting that and building the list again, and
+// against the comparison sort that relinks nodes, list::sort() (timed once, it is slow)
+void sort(std::size_t n) {
+    std::mt19937_64 gen(11);
+    std::vector<std::uint64_t> values(n);
+    for (auto& value : values) {
+        value = gen();
+    }
+
+    double rebuild = 0;
+    double radix = 0;
+    double merge = 0;
+    for (int run = 0; run < 3; ++run) {
+        {
+            saxion::forward_list<std::uint64_t> lst;
+            for (auto value : values) {
+                lst.push_back(value);
+            }
+            double ms = bench::time_ms([&lst]() {
+                std::vector<std::uint64_t> copy(lst.begin(), lst.end());
+                std::sort(copy.begin(), copy.end());
+                lst.assign(copy.begin(), copy.end());
+            });
+            rebuild = run == 0 || ms < rebuild ? ms : rebuild;
+            bench::do_not_optimize(lst.front());
+        }
+        {
+            saxion::forward_list<std::uint64_t> lst;
+            for (auto value : values) {
+                lst.push_back(value);
+            }
+            double ms = bench::time_ms([&lst]() { saxion::radix_sort(lst, [](std::uint64_t v) { return v; }); });
+            radix = run == 0 || ms < radix ? ms : radix;
+            bench::do_not_optimize(lst.front());
+        }
+        if (run == 0) {
+            saxion::list<std::uint64_t> lst;
+            for (auto value : values) {
+                lst.push_back(value);
+            }
+            merge = bench::time_ms([&lst]() { lst.sort(); });
+            bench::do_not_optimize(lst.front());
+        }
+    }
+    auto name = std::to_string(n);
+    bench::report(name + " copy, std::sort, rebuild", rebuild);
+    bench::report(name + " radix_sort", radix);
+    bench::report(name + " list::sort", merge);
+}
+
+int main(int argc, char** argv) {
+    auto n = bench::size_arg(argc, argv, 10'000'000);
+    sort(n / 10);
+    sort(n);
+    return 0;
+}
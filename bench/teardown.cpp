@@ -0,0 +1,78 @@
+//
+// Created by Saxion ACS.
+//
+
+#include "bench.h"
+#include "forward_list.h"
+#include "list.h"
+
+// only the destruction of a list of ints is timed: nodes from the heap are freed one by one, nodes
+// that reserve() set aside in a block are dropped with the block without visiting them. For heap
+// nodes, clear_incremental() bounds the stall per call and detach_and_reclaim() moves it to the
+// reclaimer thread
+template<typename _L>
+void teardown(const std::string& name, std::size_t n) {
+    double heap = 0;
+    double block = 0;
+    double retained = 0;
+    for (int run = 0; run < 3; ++run) {
+        {
+            _L lst;
+            for (std::size_t i = 0; i < n; ++i) {
+                lst.push_front(i);
+            }
+            double ms = bench::time_ms([&lst]() { lst.clear(); });
+            heap = run == 0 || ms < heap ? ms : heap;
+        }
+        {
+            _L lst;
+            lst.reserve(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                lst.push_front(i);
+            }
+            double ms = bench::time_ms([&lst]() { lst.clear(); });
+            block = run == 0 || ms < block ? ms : block;
+
+            lst.reserve(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                lst.push_front(i);
+            }
+            ms = bench::time_ms([&lst]() { lst.clear(saxion::clear_mode::retain); });
+            retained = run == 0 || ms < retained ? ms : retained;
+            bench::do_not_optimize(lst.capacity());
+        }
+    }
+    bench::report(name + " clear, nodes from the heap", heap);
+    bench::report(name + " clear, reserved block", block);
+    bench::report(name + " clear(retain), reserved block", retained);
+
+    // the longest stall of the calling thread when the nodes come from the heap
+    {
+        _L lst;
+        for (std::size_t i = 0; i < n; ++i) {
+            lst.push_front(i);
+        }
+        double longest = 0;
+        bool done = false;
+        while (!done) {
+            double ms = bench::time_ms([&lst, &done]() { done = lst.clear_incremental(100'000); });
+            longest = ms > longest ? ms : longest;
+        }
+        bench::report(name + " clear_incremental(100k), max", longest);
+    }
+    {
+        _L lst;
+        for (std::size_t i = 0; i < n; ++i) {
+            lst.push_front(i);
+        }
+        bench::report(name + " detach_and_reclaim", bench::time_ms([&lst]() { lst.detach_and_reclaim(); }));
+        bench::report(name + " background reclaim", bench::time_ms([]() { saxion::reclaimer::instance().flush(); }));
+    }
+}
+
+int main(int argc, char** argv) {
+    auto n = bench::size_arg(argc, argv, 10'000'000);
+    teardown<saxion::forward_list<std::size_t>>("forward_list", n);
+    teardown<saxion::list<std::size_t>>("list", n);
+    return 0;
+}
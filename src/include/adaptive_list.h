@@ -0,0 +1,655 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef INCLUDE_ADAPTIVE_LIST_H
+#define INCLUDE_ADAPTIVE_LIST_H
+
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "list.h"
+
+namespace saxion {
+
+    // the two representations of an adaptive_list
+    enum class adaptive_mode {
+        contiguous,
+        linked
+    };
+
+    // what an adaptive_list has seen since it was created (or since reset_stats())
+    struct adaptive_stats {
+        adaptive_mode mode;
+        // operator[] and at()
+        std::size_t indexed_reads;
+        // inserts and erases anywhere but the back: O(n) in the contiguous representation
+        std::size_t middle_edits;
+        // push_back and emplace_back
+        std::size_t appends;
+        // calls to begin(), every scan starts with one
+        std::size_t traversals;
+        // number of switches between the representations
+        std::size_t migrations;
+    };
+
+    template<typename _T>
+    class adaptive_list;
+
+    namespace detail {
+
+        template<typename _T>
+        class const_adaptive_list_iterator;
+
+        // an iterator of either representation: a pointer into the vector or an iterator of the list
+        template<typename _T>
+        class adaptive_list_iterator {
+        public:
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::bidirectional_iterator_tag;
+            using pointer = _T*;
+            using reference = _T&;
+            using value_type = _T;
+
+        private:
+            template<typename> friend
+            class ::saxion::adaptive_list;
+
+            friend
+            class ::saxion::detail::const_adaptive_list_iterator<_T>;
+
+            using list_iterator = typename ::saxion::list<_T>::iterator;
+
+            _T* _ptr;
+            list_iterator _it;
+            bool _linked;
+
+            explicit adaptive_list_iterator(_T* ptr) noexcept:
+                    _ptr(ptr),
+                    _it(),
+                    _linked(false) {}
+
+            explicit adaptive_list_iterator(list_iterator it) noexcept:
+                    _ptr(nullptr),
+                    _it(it),
+                    _linked(true) {}
+
+        public:
+            adaptive_list_iterator() noexcept:
+                    adaptive_list_iterator(static_cast<_T*>(nullptr)) {}
+
+            reference operator*() const {
+                return _linked ? *_it : *_ptr;
+            }
+
+            [[nodiscard]]
+            pointer operator->() const {
+                return std::addressof(**this);
+            }
+
+            adaptive_list_iterator& operator++() {
+                if (_linked) {
+                    ++_it;
+                } else {
+                    ++_ptr;
+                }
+                return *this;
+            }
+
+            adaptive_list_iterator operator++(int) {
+                adaptive_list_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+
+            adaptive_list_iterator& operator--() {
+                if (_linked) {
+                    --_it;
+                } else {
+                    --_ptr;
+                }
+                return *this;
+            }
+
+            adaptive_list_iterator operator--(int) {
+                adaptive_list_iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+
+            [[nodiscard]]
+            bool operator==(const adaptive_list_iterator& other) const {
+                return _linked ? _it == other._it : _ptr == other._ptr;
+            }
+
+            [[nodiscard]]
+            bool operator!=(const adaptive_list_iterator& other) const {
+                return !(*this == other);
+            }
+        };
+
+        template<typename _T>
+        class const_adaptive_list_iterator {
+        public:
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::bidirectional_iterator_tag;
+            using pointer = const _T*;
+            using reference = const _T&;
+            using value_type = _T;
+
+        private:
+            template<typename> friend
+            class ::saxion::adaptive_list;
+
+            using list_iterator = typename ::saxion::list<_T>::const_iterator;
+
+            const _T* _ptr;
+            list_iterator _it;
+            bool _linked;
+
+            explicit const_adaptive_list_iterator(const _T* ptr) noexcept:
+                    _ptr(ptr),
+                    _it(),
+                    _linked(false) {}
+
+            explicit const_adaptive_list_iterator(list_iterator it) noexcept:
+                    _ptr(nullptr),
+                    _it(it),
+                    _linked(true) {}
+
+        public:
+            const_adaptive_list_iterator() noexcept:
+                    const_adaptive_list_iterator(static_cast<const _T*>(nullptr)) {}
+
+            // implicit on purpose, just like the list iterators
+            const_adaptive_list_iterator(const adaptive_list_iterator<_T>& iter) noexcept: // NOLINT
+                    _ptr(iter._ptr),
+                    _it(iter._it),
+                    _linked(iter._linked) {}
+
+            reference operator*() const {
+                return _linked ? *_it : *_ptr;
+            }
+
+            [[nodiscard]]
+            pointer operator->() const {
+                return std::addressof(**this);
+            }
+
+            const_adaptive_list_iterator& operator++() {
+                if (_linked) {
+                    ++_it;
+                } else {
+                    ++_ptr;
+                }
+                return *this;
+            }
+
+            const_adaptive_list_iterator operator++(int) {
+                const_adaptive_list_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+
+            const_adaptive_list_iterator& operator--() {
+                if (_linked) {
+                    --_it;
+                } else {
+                    --_ptr;
+                }
+                return *this;
+            }
+
+            const_adaptive_list_iterator operator--(int) {
+                const_adaptive_list_iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+
+            [[nodiscard]]
+            bool operator==(const const_adaptive_list_iterator& other) const {
+                return _linked ? _it == other._it : _ptr == other._ptr;
+            }
+
+            [[nodiscard]]
+            bool operator!=(const const_adaptive_list_iterator& other) const {
+                return !(*this == other);
+            }
+        };
+    }
+
+    // a sequence with the API of saxion::list that is stored either in a vector or in a list
+    // it counts its operations, and every adapt_window operations it looks at the mix of the last window:
+    //  - contiguous -> linked when at least 1/linked_ratio of the operations edited the middle (or the front)
+    //    of a sequence of at least linked_min_size elements, where every such edit moves O(n) elements
+    //  - linked -> contiguous when fewer than 1/contiguous_ratio of the operations did, so the
+    //    indexed reads, appends and scans get the vector back
+    // the gap between the two ratios keeps a mixed workload from flipping back and forth.
+    // A migration moves every element, so like in a vector, every insertion may invalidate all iterators
+    // and references. Reads and erases never migrate
+    template<typename _T>
+    class adaptive_list {
+    public:
+        using value_type = _T;
+        using reference = _T&;
+        using const_reference = _T const&;
+        using pointer = _T*;
+        using const_pointer = _T const*;
+        using size_type = std::size_t;
+
+        using iterator = detail::adaptive_list_iterator<_T>;
+        using const_iterator = detail::const_adaptive_list_iterator<_T>;
+
+        static constexpr size_type adapt_window = 256;
+        static constexpr size_type linked_ratio = 4;
+        static constexpr size_type contiguous_ratio = 16;
+        static constexpr size_type linked_min_size = 128;
+
+    private:
+
+        adaptive_mode _mode;
+        std::vector<_T> _vector;
+        list<_T> _list;
+        // the counters are updated by const reads as well
+        mutable adaptive_stats _stats;
+        // the counters of the current window
+        mutable size_type _window_ops;
+        mutable size_type _window_edits;
+
+    public:
+
+        adaptive_list() :
+                _mode{adaptive_mode::contiguous},
+                _vector{},
+                _list{},
+                _stats{adaptive_mode::contiguous, 0, 0, 0, 0, 0},
+                _window_ops{0},
+                _window_edits{0} {
+        }
+
+        template<typename _V>
+        adaptive_list(std::initializer_list<_V> init_list) :
+                adaptive_list() {
+            _vector.reserve(init_list.size());
+            for (auto item : init_list) {
+                _vector.emplace_back(std::move(item));
+            }
+        }
+
+        // the copy starts out in the representation of the original, with fresh statistics
+        adaptive_list(const adaptive_list& other) :
+                adaptive_list() {
+            _mode = other._mode;
+            _stats.mode = _mode;
+            _vector = other._vector;
+            _list = other._list;
+        }
+
+        adaptive_list& operator=(const adaptive_list& other) {
+            if (this != &other) {
+                adaptive_list copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        adaptive_list(adaptive_list&& other) noexcept :
+                adaptive_list() {
+            swap(other);
+        }
+
+        adaptive_list& operator=(adaptive_list&& other) noexcept {
+            if (this != &other) {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        void swap(adaptive_list& other) noexcept {
+            std::swap(_mode, other._mode);
+            _vector.swap(other._vector);
+            _list.swap(other._list);
+            std::swap(_stats, other._stats);
+            std::swap(_window_ops, other._window_ops);
+            std::swap(_window_edits, other._window_edits);
+        }
+
+        [[nodiscard]]
+        iterator begin() noexcept {
+            ++_stats.traversals;
+            return linked() ? iterator(_list.begin()) : iterator(_vector.data());
+        }
+
+        [[nodiscard]]
+        iterator end() noexcept {
+            return linked() ? iterator(_list.end()) : iterator(_vector.data() + _vector.size());
+        }
+
+        [[nodiscard]]
+        const_iterator begin() const noexcept {
+            ++_stats.traversals;
+            return linked() ? const_iterator(_list.cbegin()) : const_iterator(_vector.data());
+        }
+
+        [[nodiscard]]
+        const_iterator end() const noexcept {
+            return linked() ? const_iterator(_list.cend()) : const_iterator(_vector.data() + _vector.size());
+        }
+
+        [[nodiscard]]
+        const_iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        [[nodiscard]]
+        const_iterator cend() const noexcept {
+            return end();
+        }
+
+        // accessors
+        [[nodiscard]]
+        reference front() {
+            return linked() ? _list.front() : _vector.front();
+        }
+
+        [[nodiscard]]
+        const_reference front() const {
+            return linked() ? _list.front() : _vector.front();
+        }
+
+        [[nodiscard]]
+        reference back() {
+            return linked() ? _list.back() : _vector.back();
+        }
+
+        [[nodiscard]]
+        const_reference back() const {
+            return linked() ? _list.back() : _vector.back();
+        }
+
+        [[nodiscard]]
+        reference operator[](size_type index) {
+            record_read();
+            return linked() ? _list[index] : _vector[index];
+        }
+
+        [[nodiscard]]
+        const_reference operator[](size_type index) const {
+            record_read();
+            return linked() ? _list[index] : _vector[index];
+        }
+
+        [[nodiscard]]
+        reference at(size_type index) {
+            if (index < size()) {
+                return (*this)[index];
+            }
+            throw std::length_error("index out of bounds");
+        }
+
+        [[nodiscard]]
+        const_reference at(size_type index) const {
+            if (index < size()) {
+                return (*this)[index];
+            }
+            throw std::length_error("index out of bounds");
+        }
+
+        [[nodiscard]]
+        bool empty() const {
+            return size() == 0;
+        }
+
+        [[nodiscard]]
+        size_type size() const {
+            return linked() ? _list.size() : _vector.size();
+        }
+
+        [[nodiscard]]
+        adaptive_mode mode() const noexcept {
+            return _mode;
+        }
+
+        [[nodiscard]]
+        adaptive_stats stats() const noexcept {
+            return _stats;
+        }
+
+        // starts counting again, the mode is kept
+        void reset_stats() noexcept {
+            _stats = adaptive_stats{_mode, 0, 0, 0, 0, 0};
+            _window_ops = 0;
+            _window_edits = 0;
+        }
+
+        // modifiers
+        void clear() noexcept {
+            _vector.clear();
+            _list.clear();
+        }
+
+        iterator push_back(_T&& value) {
+            return emplace_back(std::move(value));
+        }
+
+        iterator push_back(const_reference value) {
+            return emplace_back(value);
+        }
+
+        // the element is built before a full window can migrate: args may refer to an element of this
+        // list, which the migration would move away
+        template<typename... Args>
+        iterator emplace_back(Args&& ... args) {
+            ++_stats.appends;
+            bool full = record_op(false);
+            iterator inserted;
+            if (linked()) {
+                inserted = iterator(_list.emplace_back(std::forward<Args>(args)...));
+            } else {
+                _vector.emplace_back(std::forward<Args>(args)...);
+                inserted = iterator(_vector.data() + _vector.size() - 1);
+            }
+            if (full && adapt()) {
+                return at_index(size() - 1);
+            }
+            return inserted;
+        }
+
+        template<typename V>
+        iterator push_front(V&& value) {
+            return emplace(cbegin_unrecorded(), std::forward<V>(value));
+        }
+
+        void pop_front() noexcept {
+            if (!empty()) {
+                erase(cbegin_unrecorded());
+            }
+        }
+
+        void pop_back() noexcept {
+            if (linked()) {
+                _list.pop_back();
+            } else if (!_vector.empty()) {
+                _vector.pop_back();
+            }
+        }
+
+        iterator insert(const_iterator pos, const_reference value) {
+            return emplace(pos, value);
+        }
+
+        iterator insert(const_iterator pos, _T&& value) {
+            return emplace(pos, std::move(value));
+        }
+
+        template<typename... Args>
+        iterator emplace(const_iterator pos, Args&& ... args) {
+            if (pos == cend()) {
+                return emplace_back(std::forward<Args>(args)...);
+            }
+            ++_stats.middle_edits;
+            bool full = record_op(true);
+            // inserted first, like in emplace_back(): args may refer to an element that a migration moves
+            iterator inserted = linked()
+                                ? iterator(_list.emplace(list_iterator_of(pos), std::forward<Args>(args)...))
+                                : emplace_at(pos._ptr - _vector.data(), std::forward<Args>(args)...);
+            if (full) {
+                // the iterator doesn't survive a migration, its index does. Finding the index in the list
+                // is O(n), just like the migration itself
+                size_type index = index_of(inserted);
+                if (adapt()) {
+                    return at_index(index);
+                }
+            }
+            return inserted;
+        }
+
+        // removes the element pointed to by pos and returns an iterator to the element that followed it
+        iterator erase(const_iterator pos) {
+            if (linked()) {
+                if (pos._it != std::prev(_list.cend())) {
+                    ++_stats.middle_edits;
+                    record_op(true);
+                }
+                return iterator(_list.erase(list_iterator_of(pos)));
+            }
+            size_type index = pos._ptr - _vector.data();
+            if (index + 1 != _vector.size()) {
+                ++_stats.middle_edits;
+                record_op(true);
+            }
+            _vector.erase(_vector.begin() + index);
+            return iterator(_vector.data() + index);
+        }
+
+        // evaluates the current window right away, returns true if the representation changed
+        bool adapt() {
+            bool migrated = decide();
+            _window_ops = 0;
+            _window_edits = 0;
+            return migrated;
+        }
+
+    private:
+
+        [[nodiscard]]
+        bool linked() const noexcept {
+            return _mode == adaptive_mode::linked;
+        }
+
+        // begin() without counting a traversal, for the modifiers that use it
+        [[nodiscard]]
+        const_iterator cbegin_unrecorded() const noexcept {
+            return linked() ? const_iterator(_list.cbegin()) : const_iterator(_vector.data());
+        }
+
+        void record_read() const noexcept {
+            ++_stats.indexed_reads;
+            ++_window_ops;
+        }
+
+        // counts an operation, returns true when the window is full. Only the insertions act on that,
+        // a full window is otherwise evaluated by the next insertion
+        bool record_op(bool edit) noexcept {
+            ++_window_ops;
+            if (edit) {
+                ++_window_edits;
+            }
+            return _window_ops >= adapt_window;
+        }
+
+        [[nodiscard]]
+        bool decide() {
+            if (_window_ops == 0) {
+                return false;
+            }
+            if (!linked() && _window_edits * linked_ratio >= _window_ops && size() >= linked_min_size) {
+                migrate(adaptive_mode::linked);
+                return true;
+            }
+            if (linked() && _window_edits * contiguous_ratio < _window_ops) {
+                migrate(adaptive_mode::contiguous);
+                return true;
+            }
+            return false;
+        }
+
+        // the new representation is built on the side and swapped in at the end. All its memory is taken
+        // up front, so after that only the moves are left; an element that may throw when it is moved is
+        // copied instead. When building it throws, the container is left as it was
+        void migrate(adaptive_mode mode) {
+            if (mode == adaptive_mode::linked) {
+                list<_T> linked;
+                linked.reserve(_vector.size());
+                for (auto& value : _vector) {
+                    linked.push_back(std::move_if_noexcept(value));
+                }
+                _list.swap(linked);
+                std::vector<_T>().swap(_vector);
+            } else {
+                std::vector<_T> contiguous;
+                contiguous.reserve(_list.size());
+                for (auto& value : _list) {
+                    contiguous.push_back(std::move_if_noexcept(value));
+                }
+                _vector.swap(contiguous);
+                _list.clear();
+            }
+            _mode = mode;
+            _stats.mode = mode;
+            ++_stats.migrations;
+        }
+
+        [[nodiscard]]
+        typename list<_T>::iterator list_iterator_of(const_iterator pos) {
+            return typename list<_T>::iterator(pos._it);
+        }
+
+        [[nodiscard]]
+        size_type index_of(const_iterator pos) const {
+            if (linked()) {
+                return static_cast<size_type>(std::distance(_list.cbegin(), pos._it));
+            }
+            return pos._ptr - _vector.data();
+        }
+
+        [[nodiscard]]
+        iterator at_index(size_type index) {
+            if (linked()) {
+                return iterator(std::next(_list.begin(), static_cast<std::ptrdiff_t>(index)));
+            }
+            return iterator(_vector.data() + index);
+        }
+
+        template<typename... Args>
+        iterator emplace_at(size_type index, Args&& ... args) {
+            if (linked()) {
+                auto pos = _list.begin();
+                std::advance(pos, index);
+                return iterator(_list.emplace(pos, std::forward<Args>(args)...));
+            }
+            auto inserted = _vector.emplace(_vector.begin() + index, std::forward<Args>(args)...);
+            return iterator(std::addressof(*inserted));
+        }
+    };
+
+    template<typename _V>
+    adaptive_list(std::initializer_list<_V>) -> adaptive_list<_V>;
+
+    adaptive_list(std::initializer_list<const char*>) -> adaptive_list<std::string>;
+
+}
+
+namespace std {
+    template<typename _T>
+    inline void swap(saxion::adaptive_list<_T>& x, saxion::adaptive_list<_T>& y) noexcept {
+        x.swap(y);
+    }
+}
+
+#endif //INCLUDE_ADAPTIVE_LIST_H
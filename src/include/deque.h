@@ -0,0 +1,711 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef INCLUDE_DEQUE_H
+#define INCLUDE_DEQUE_H
+
+#include <type_traits>
+#include <iterator>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace saxion {
+
+    //forward declaration of the class deque
+    template<typename _T>
+    class deque;
+
+    namespace detail {
+        template<typename _T, typename _Dq>
+        struct deque_iterator;
+
+        template<typename _T, typename _Dq>
+        struct const_deque_iterator;
+    }
+
+    namespace detail {
+
+        // the number of elements in one chunk of a deque: chunks of about 4kB, but never less than 16 elements
+        // always a power of two, so that the index arithmetic turns into shifts and masks
+        template<typename _T>
+        constexpr std::size_t deque_chunk_size() {
+            std::size_t size = 16;
+            while (size * sizeof(_T) < 4096) {
+                size *= 2;
+            }
+            return size;
+        }
+
+        // the deque iterators follow the conventions of the list iterators, but instead of a node
+        // they refer to a position in the deque. That makes all the random access operations O(1).
+        template<typename _T, typename _Dq>
+        struct deque_iterator {
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::random_access_iterator_tag;
+            using pointer = _T*;
+            using reference = _T&;
+            using value_type = _T;
+
+            template<typename> friend
+            class ::saxion::deque;
+
+            using deque_t = _Dq;
+
+            // the deque this iterator belongs to and the index of the current element
+            deque_t* _deque;
+            difference_type _index;
+
+            // never to be used constrcutor!
+            // it is only here so we can default initalize an invalid iterator
+            deque_iterator() noexcept:
+                    _deque(nullptr),
+                    _index(0) {}
+
+            deque_iterator(deque_t* deque, difference_type index) noexcept:
+                    _deque(deque),
+                    _index(index) {}
+
+            // conversion from the constant iterator
+            explicit deque_iterator(const const_deque_iterator<_T, _Dq>& iter) noexcept:
+                    _deque(const_cast<deque_t*>(iter._deque)),
+                    _index(iter._index) {
+            }
+
+            // dereferencing
+            reference operator*() const {
+                return (*_deque)[static_cast<std::size_t>(_index)];
+            }
+
+            [[nodiscard]]
+            pointer operator->() const {
+                return std::addressof(**this);
+            }
+
+            reference operator[](difference_type n) const {
+                return (*_deque)[static_cast<std::size_t>(_index + n)];
+            }
+
+            // iterating
+            deque_iterator& operator++() {
+                ++_index;
+                return *this;
+            }
+
+            deque_iterator operator++(int) {
+                deque_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+
+            deque_iterator& operator--() {
+                --_index;
+                return *this;
+            }
+
+            deque_iterator operator--(int) {
+                deque_iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+
+            deque_iterator& operator+=(difference_type n) {
+                _index += n;
+                return *this;
+            }
+
+            deque_iterator& operator-=(difference_type n) {
+                _index -= n;
+                return *this;
+            }
+
+            [[nodiscard]]
+            deque_iterator operator+(difference_type n) const {
+                return deque_iterator(_deque, _index + n);
+            }
+
+            [[nodiscard]]
+            friend deque_iterator operator+(difference_type n, const deque_iterator& iter) {
+                return iter + n;
+            }
+
+            [[nodiscard]]
+            deque_iterator operator-(difference_type n) const {
+                return deque_iterator(_deque, _index - n);
+            }
+
+            [[nodiscard]]
+            difference_type operator-(const deque_iterator& other) const {
+                return _index - other._index;
+            }
+
+            [[nodiscard]]
+            bool operator==(const deque_iterator& other) const {
+                return _index == other._index;
+            }
+
+            [[nodiscard]]
+            bool operator!=(const deque_iterator& other) const {
+                return !(*this == other);
+            }
+
+            [[nodiscard]]
+            bool operator<(const deque_iterator& other) const {
+                return _index < other._index;
+            }
+
+            [[nodiscard]]
+            bool operator>(const deque_iterator& other) const {
+                return other < *this;
+            }
+
+            [[nodiscard]]
+            bool operator<=(const deque_iterator& other) const {
+                return !(other < *this);
+            }
+
+            [[nodiscard]]
+            bool operator>=(const deque_iterator& other) const {
+                return !(*this < other);
+            }
+        };
+
+        template<typename _T, typename _Dq>
+        struct const_deque_iterator {
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::random_access_iterator_tag;
+            using pointer = const _T*;
+            using reference = const _T&;
+            using value_type = _T;
+
+            template<typename> friend
+            class ::saxion::deque;
+
+            using deque_t = _Dq;
+
+            const deque_t* _deque;
+            difference_type _index;
+
+            // never to be used constrcutor!
+            // it is only here so we can default initalize an invalid iterator
+            const_deque_iterator() noexcept:
+                    _deque(nullptr),
+                    _index(0) {}
+
+            const_deque_iterator(const deque_t* deque, difference_type index) noexcept:
+                    _deque(deque),
+                    _index(index) {}
+
+            // implicit on purpose: a mutable iterator can always be used where a constant one is expected
+            const_deque_iterator(const deque_iterator<_T, _Dq>& iter) noexcept: // NOLINT
+                    _deque(iter._deque),
+                    _index(iter._index) {
+            }
+
+            reference operator*() const {
+                return (*_deque)[static_cast<std::size_t>(_index)];
+            }
+
+            [[nodiscard]]
+            pointer operator->() const {
+                return std::addressof(**this);
+            }
+
+            reference operator[](difference_type n) const {
+                return (*_deque)[static_cast<std::size_t>(_index + n)];
+            }
+
+            const_deque_iterator& operator++() {
+                ++_index;
+                return *this;
+            }
+
+            const_deque_iterator operator++(int) {
+                const_deque_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+
+            const_deque_iterator& operator--() {
+                --_index;
+                return *this;
+            }
+
+            const_deque_iterator operator--(int) {
+                const_deque_iterator tmp(*this);
+                --(*this);
+                return tmp;
+            }
+
+            const_deque_iterator& operator+=(difference_type n) {
+                _index += n;
+                return *this;
+            }
+
+            const_deque_iterator& operator-=(difference_type n) {
+                _index -= n;
+                return *this;
+            }
+
+            [[nodiscard]]
+            const_deque_iterator operator+(difference_type n) const {
+                return const_deque_iterator(_deque, _index + n);
+            }
+
+            [[nodiscard]]
+            friend const_deque_iterator operator+(difference_type n, const const_deque_iterator& iter) {
+                return iter + n;
+            }
+
+            [[nodiscard]]
+            const_deque_iterator operator-(difference_type n) const {
+                return const_deque_iterator(_deque, _index - n);
+            }
+
+            [[nodiscard]]
+            difference_type operator-(const const_deque_iterator& other) const {
+                return _index - other._index;
+            }
+
+            [[nodiscard]]
+            bool operator==(const const_deque_iterator& other) const {
+                return _index == other._index;
+            }
+
+            [[nodiscard]]
+            bool operator!=(const const_deque_iterator& other) const {
+                return !(*this == other);
+            }
+
+            [[nodiscard]]
+            bool operator<(const const_deque_iterator& other) const {
+                return _index < other._index;
+            }
+
+            [[nodiscard]]
+            bool operator>(const const_deque_iterator& other) const {
+                return other < *this;
+            }
+
+            [[nodiscard]]
+            bool operator<=(const const_deque_iterator& other) const {
+                return !(other < *this);
+            }
+
+            [[nodiscard]]
+            bool operator>=(const const_deque_iterator& other) const {
+                return !(*this < other);
+            }
+        };
+
+        // comparison operators
+        template <typename _T, typename _Dq>
+        [[nodiscard]]
+        inline bool operator==(const deque_iterator<_T, _Dq>& lhs, const const_deque_iterator<_T, _Dq>& rhs) {
+            return lhs._index == rhs._index;
+        }
+
+        template <typename _T, typename _Dq>
+        [[nodiscard]]
+        inline bool operator!=(const deque_iterator<_T, _Dq>& lhs, const const_deque_iterator<_T, _Dq>& rhs) {
+            return !(lhs == rhs);
+        }
+    }
+
+    // a double-ended queue made of fixed-size chunks
+    // the chunks are referenced from a circular map, so pushing and popping at either end
+    // only allocates (or frees) a chunk once every chunk_size elements, and element i
+    // is found with a shift and a mask: operator[] is O(1)
+    template<typename _T>
+    class deque {
+    public:
+        using value_type = _T;
+        using reference = _T&;
+        using const_reference = _T const&;
+        using pointer = _T*;
+        using const_pointer = _T const*;
+        using size_type = std::size_t;
+
+        static constexpr size_type chunk_size = detail::deque_chunk_size<_T>();
+
+    private:
+
+        using allocator_t = std::allocator<_T>;
+        using traits_t = std::allocator_traits<allocator_t>;
+
+        allocator_t _alloc;
+        // the circular chunk map; its capacity is always a power of two
+        std::unique_ptr<pointer[]> _map;
+        size_type _map_capacity;
+        // the map slot of the first chunk in use and the number of chunks in use
+        size_type _map_head;
+        size_type _chunks;
+        // the position of the first element inside the first chunk
+        size_type _offset;
+        size_type _size;
+        // one emptied chunk is kept around, so a queue oscillating around a chunk boundary doesn't
+        // allocate and free the same chunk over and over
+        pointer _spare;
+
+    public:
+
+        using iterator = detail::deque_iterator<_T, deque>;
+        using const_iterator = detail::const_deque_iterator<_T, deque>;
+
+        // default ctor
+        deque() :
+                _alloc{},
+                _map{nullptr},
+                _map_capacity{0},
+                _map_head{0},
+                _chunks{0},
+                _offset{0},
+                _size{0},
+                _spare{nullptr} {
+        }
+
+        template<typename _V>
+        deque(std::initializer_list<_V> init_list) :
+                deque() {
+            for (auto item : init_list) {
+                push_back(std::move(item));
+            }
+        }
+
+        // copy ctor
+        deque(const deque& other) :
+                deque() {
+            for (auto& value : other) {
+                push_back(value);
+            }
+        }
+
+        // copy assignment operator
+        deque& operator=(const deque& other) {
+            if (this != &other) {
+                clear();
+                for (auto& value : other) {
+                    push_back(value);
+                }
+            }
+            return *this;
+        }
+
+        // move ctor
+        deque(deque&& other) noexcept :
+                deque() {
+            swap(other);
+        }
+
+        // move assignment operator
+        deque& operator=(deque&& other) noexcept {
+            if (this != &other) {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        template<typename _Iter, typename = std::enable_if_t<
+                std::is_same_v<
+                        typename std::iterator_traits<_Iter>::value_type,
+                        value_type >>>
+        deque(_Iter begin, _Iter end):
+                deque() {
+            for (; begin != end; ++begin) {
+                push_back(*begin);
+            }
+        }
+
+        ~deque() noexcept {
+            clear();
+            for (size_type i = 0; i < _chunks; ++i) {
+                traits_t::deallocate(_alloc, _map[slot(i)], chunk_size);
+            }
+            if (_spare) {
+                traits_t::deallocate(_alloc, _spare, chunk_size);
+            }
+        }
+
+        [[nodiscard]]
+        iterator begin() noexcept {
+            return iterator(this, 0);
+        }
+
+        [[nodiscard]]
+        iterator end() noexcept {
+            return iterator(this, static_cast<typename iterator::difference_type>(_size));
+        }
+
+        [[nodiscard]]
+        const_iterator begin() const noexcept {
+            return const_iterator(this, 0);
+        }
+
+        [[nodiscard]]
+        const_iterator end() const noexcept {
+            return const_iterator(this, static_cast<typename const_iterator::difference_type>(_size));
+        }
+
+        [[nodiscard]]
+        const_iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        [[nodiscard]]
+        const_iterator cend() const noexcept {
+            return end();
+        }
+
+        void swap(deque& other) noexcept {
+            std::swap(_map, other._map);
+            std::swap(_map_capacity, other._map_capacity);
+            std::swap(_map_head, other._map_head);
+            std::swap(_chunks, other._chunks);
+            std::swap(_offset, other._offset);
+            std::swap(_size, other._size);
+            std::swap(_spare, other._spare);
+        }
+
+        // accessors
+        [[nodiscard]]
+        reference front() {
+            return (*this)[0];
+        }
+
+        [[nodiscard]]
+        const_reference front() const {
+            return (*this)[0];
+        }
+
+        [[nodiscard]]
+        reference back() {
+            return (*this)[_size - 1];
+        }
+
+        [[nodiscard]]
+        const_reference back() const {
+            return (*this)[_size - 1];
+        }
+
+        [[nodiscard]]
+        reference operator[](size_type index) {
+            return *element(index);
+        }
+
+        [[nodiscard]]
+        const_reference operator[](size_type index) const {
+            return *element(index);
+        }
+
+        [[nodiscard]]
+        reference at(size_type index) {
+            if (index < _size) {
+                return *element(index);
+            }
+            throw std::length_error("index out of bounds");
+        }
+
+        [[nodiscard]]
+        const_reference at(size_type index) const {
+            if (index < _size) {
+                return *element(index);
+            }
+            throw std::length_error("index out of bounds");
+        }
+
+        [[nodiscard]]
+        bool empty() const {
+            return _size == 0;
+        }
+
+        [[nodiscard]]
+        size_type size() const {
+            return _size;
+        }
+
+        void clear() noexcept {
+            while (!empty()) {
+                pop_back();
+            }
+        }
+
+        // modifiers
+        iterator push_back(_T&& value) {
+            return emplace_back(std::move(value));
+        }
+
+        iterator push_back(const_reference value) {
+            return emplace_back(value);
+        }
+
+        template<typename... Args>
+        iterator emplace_back(Args&& ... args) {
+            bool grown = _offset + _size == _chunks * chunk_size;
+            if (grown) {
+                grow_back();
+            }
+            try {
+                traits_t::construct(_alloc, element(_size), std::forward<Args>(args)...);
+            } catch (...) {
+                // give the chunk back, otherwise it stays in the map without any element in it
+                if (grown) {
+                    shrink_back();
+                }
+                throw;
+            }
+            ++_size;
+            return iterator(this, static_cast<typename iterator::difference_type>(_size - 1));
+        }
+
+        template<typename V>
+        iterator push_front(V&& value) {
+            return emplace_front(std::forward<V>(value));
+        }
+
+        template<typename... Args>
+        iterator emplace_front(Args&& ... args) {
+            bool grown = _offset == 0;
+            if (grown) {
+                grow_front();
+            }
+            try {
+                traits_t::construct(_alloc, _map[_map_head] + _offset - 1, std::forward<Args>(args)...);
+            } catch (...) {
+                if (grown) {
+                    shrink_front();
+                }
+                throw;
+            }
+            --_offset;
+            ++_size;
+            return begin();
+        }
+
+        void pop_front() noexcept {
+            if (!empty()) {
+                traits_t::destroy(_alloc, element(0));
+                --_size;
+                if (++_offset == chunk_size || _size == 0) {
+                    // the first chunk is no longer used
+                    release(_map[_map_head]);
+                    _map_head = (_map_head + 1) & (_map_capacity - 1);
+                    --_chunks;
+                    _offset = 0;
+                }
+            }
+        }
+
+        void pop_back() noexcept {
+            if (!empty()) {
+                traits_t::destroy(_alloc, element(_size - 1));
+                --_size;
+                if (_size == 0) {
+                    // all the chunks are empty now, this also resets the offset
+                    release(_map[_map_head]);
+                    _map_head = 0;
+                    _chunks = 0;
+                    _offset = 0;
+                } else if ((_offset + _size) % chunk_size == 0) {
+                    // the last chunk is no longer used
+                    release(_map[slot(_chunks - 1)]);
+                    --_chunks;
+                }
+            }
+        }
+
+    private:
+
+        // the map slot of the i-th chunk in use
+        [[nodiscard]]
+        size_type slot(size_type chunk) const noexcept {
+            return (_map_head + chunk) & (_map_capacity - 1);
+        }
+
+        [[nodiscard]]
+        pointer element(size_type index) const noexcept {
+            size_type position = _offset + index;
+            return _map[slot(position / chunk_size)] + position % chunk_size;
+        }
+
+        pointer acquire() {
+            if (_spare) {
+                return std::exchange(_spare, nullptr);
+            }
+            return traits_t::allocate(_alloc, chunk_size);
+        }
+
+        void release(pointer chunk) noexcept {
+            if (_spare) {
+                traits_t::deallocate(_alloc, chunk, chunk_size);
+            } else {
+                _spare = chunk;
+            }
+        }
+
+        // makes room in the map for one more chunk, doubling it if it is full
+        void reserve_map_slot() {
+            if (_chunks < _map_capacity) {
+                return;
+            }
+            size_type capacity = _map_capacity ? _map_capacity * 2 : 8;
+            auto map = std::make_unique<pointer[]>(capacity);
+            for (size_type i = 0; i < _chunks; ++i) {
+                map[i] = _map[slot(i)];
+            }
+            _map = std::move(map);
+            _map_capacity = capacity;
+            _map_head = 0;
+        }
+
+        void grow_back() {
+            reserve_map_slot();
+            pointer chunk = acquire();
+            _map[slot(_chunks)] = chunk;
+            ++_chunks;
+        }
+
+        void grow_front() {
+            reserve_map_slot();
+            pointer chunk = acquire();
+            _map_head = (_map_head + _map_capacity - 1) & (_map_capacity - 1);
+            _map[_map_head] = chunk;
+            ++_chunks;
+            _offset += chunk_size;
+        }
+
+        // undo grow_back() / grow_front() when the element for the new chunk could not be made
+        void shrink_back() noexcept {
+            release(_map[slot(_chunks - 1)]);
+            --_chunks;
+        }
+
+        void shrink_front() noexcept {
+            release(_map[_map_head]);
+            _map_head = (_map_head + 1) & (_map_capacity - 1);
+            --_chunks;
+            _offset -= chunk_size;
+        }
+
+    };
+
+    template<typename _Iter>
+    deque(_Iter b, _Iter e) -> deque<typename std::iterator_traits<_Iter>::value_type>;
+
+    template<typename _V>
+    deque(std::initializer_list<_V>) -> deque<_V>;
+
+    deque(std::initializer_list<const char*>) -> deque<std::string>;
+
+}
+
+namespace std{
+    template<typename _T>
+    inline void swap(saxion::deque<_T>& x, saxion::deque <_T>& y) noexcept {
+        x.swap(y);
+    }
+}
+
+#endif //INCLUDE_DEQUE_H
@@ -5,17 +5,33 @@
 #ifndef forward_listS_FORWARD_forward_list_H
 #define forward_listS_FORWARD_forward_list_H
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <type_traits>
 #include <iterator>
 #include <initializer_list>
 #include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "size_policy.h"
+#include "node_pool.h"
+#include "reclaimer.h"
 
 namespace saxion {
 
     //forward declaration of the class forward_list
-    template<typename _T>
+    template<typename _T, typename _SizePolicy, typename _Nd>
     class forward_list;
 
+    template<typename _T, typename _SizePolicy, typename _Nd, typename _KeyFn>
+    void radix_sort(forward_list<_T, _SizePolicy, _Nd>& lst, _KeyFn key_fn);
+
+    template<typename _Iter, typename _Comp>
+    typename std::iterator_traits<_Iter>::value_type merge_k(_Iter first, _Iter last, _Comp comp);
+
     namespace detail {
         template<typename _T, typename _Nd>
         class forward_list_iterator;
@@ -27,13 +43,109 @@ namespace saxion {
     // normally all the things that are not intended for public use are grouped in an internal namespace (often "detail")
     namespace detail {
 
-        template<typename _T>
+        // owns the next node, like a std::unique_ptr. A node that lives in a block of nodes (see the bulk
+        // constructors of forward_list) can't be deleted on its own, it is only destroyed: its memory goes
+        // back with the block. The node has no spare bits for that, so the lowest bit of the pointer to it
+        // tells, and the node stays as small as it was
+        template<typename _Nd>
+        class forward_link {
+        public:
+            forward_link() noexcept:
+                    _bits{0} {}
+
+            forward_link(std::nullptr_t) noexcept:
+                    _bits{0} {}
+
+            explicit forward_link(_Nd* node, bool in_block = false) noexcept:
+                    _bits{reinterpret_cast<std::uintptr_t>(node) | static_cast<std::uintptr_t>(in_block)} {}
+
+            forward_link(const forward_link&) = delete;
+
+            forward_link& operator=(const forward_link&) = delete;
+
+            forward_link(forward_link&& other) noexcept:
+                    _bits{other._bits} {
+                other._bits = 0;
+            }
+
+            // like the one of std::unique_ptr: other may be owned by the node that this link lets go of
+            forward_link& operator=(forward_link&& other) noexcept {
+                std::uintptr_t old = _bits;
+                _bits = other._bits;
+                other._bits = 0;
+                destroy(old);
+                return *this;
+            }
+
+            ~forward_link() noexcept {
+                destroy(_bits);
+            }
+
+            [[nodiscard]]
+            _Nd* get() const noexcept {
+                return reinterpret_cast<_Nd*>(_bits & ~std::uintptr_t{1});
+            }
+
+            // only for a node that doesn't live in a block, the pointer can't tell any more
+            _Nd* release() noexcept {
+                _Nd* node = get();
+                _bits = 0;
+                return node;
+            }
+
+            void reset(_Nd* node = nullptr) noexcept {
+                std::uintptr_t old = _bits;
+                _bits = reinterpret_cast<std::uintptr_t>(node);
+                destroy(old);
+            }
+
+            [[nodiscard]]
+            bool in_block() const noexcept {
+                return _bits & 1u;
+            }
+
+            _Nd* operator->() const noexcept {
+                return get();
+            }
+
+            _Nd& operator*() const noexcept {
+                return *get();
+            }
+
+            explicit operator bool() const noexcept {
+                return _bits != 0;
+            }
+
+        private:
+            std::uintptr_t _bits;
+
+            static void destroy(std::uintptr_t bits) noexcept {
+                static_assert(alignof(_Nd) > 1, "the lowest bit of a node pointer has to be free");
+                auto* node = reinterpret_cast<_Nd*>(bits & ~std::uintptr_t{1});
+                if (!node) {
+                    return;
+                }
+                if (bits & 1u) {
+                    node->~_Nd();
+                } else {
+                    delete node;
+                }
+            }
+        };
+
+        // a custom node (see list_nodes.h) derives from this one and passes itself as _Derived
+        template<typename _T, typename _Derived = void>
         struct forward_list_node_t {
-            template<typename T> friend
+            template<typename, typename, typename> friend
             class ::saxion::forward_list;
 
+            // the type the links point to
+            using node_type = std::conditional_t<std::is_void_v<_Derived>, forward_list_node_t, _Derived>;
+
+            using link_type = forward_link<node_type>;
+
             _T _value;
-            std::unique_ptr<forward_list_node_t> _next;
+            link_type _next;
 
             forward_list_node_t(const forward_list_node_t&) = delete;
 
@@ -69,13 +181,19 @@ namespace saxion {
                 std::swap(_value, other._value);
             }
 
-            forward_list_node_t(_T&& v, forward_list_node_t* next) :
+            forward_list_node_t(_T&& v, link_type next) :
                     _value{std::move(v)},
-                    _next{next} {}
+                    _next{std::move(next)} {}
 
-            forward_list_node_t(_T const& v, forward_list_node_t* next) :
+            forward_list_node_t(_T const& v, link_type next) :
                     _value{v},
-                    _next{next} {}
+                    _next{std::move(next)} {}
+
+            // the piecewise constructor: the value is constructed from args right inside the node
+            template<typename... Args>
+            forward_list_node_t(std::in_place_t, link_type next, Args&& ... args) :
+                    _value(std::forward<Args>(args)...),
+                    _next{std::move(next)} {}
 
             _T& value() {
                 return _value;
@@ -86,21 +204,51 @@ namespace saxion {
             }
 
             [[nodiscard]]
-            forward_list_node_t* next() const noexcept{
+            node_type* next() const noexcept{
                 return _next.get();
             }
 
+            // the link to a node that was built in a block
+            [[nodiscard]]
+            static link_type block_link(node_type* node) noexcept {
+                return link_type(node, true);
+            }
+
+            // see list_node_t::trivial_payload
+            static constexpr bool trivial_payload = std::is_trivially_destructible_v<_T>;
+
+            // see list_node_t::assign
+            template<typename _V>
+            void assign(_V&& value) {
+                _value = std::forward<_V>(value);
+            }
+
+            // the lookup protocol of forward_list::find, the same as the one of the list node
+            template<typename _Key>
+            [[nodiscard]]
+            static const _Key& probe(const _Key& key) noexcept {
+                return key;
+            }
+
+            template<typename _Probe>
+            [[nodiscard]]
+            bool matches(const _Probe& probe) const {
+                return _value == probe;
+            }
+
         };
 
         template<typename _T, typename _Nd = forward_list_node_t<_T>>
         class forward_list_iterator {
+        public:
             using difference_type = std::ptrdiff_t;
             using iterator_category = std::forward_iterator_tag;
             using pointer = _T*;
             using reference = _T&;
             using value_type = _T;
 
-            template<typename> friend
+        private:
+            template<typename, typename, typename> friend
             class ::saxion::forward_list;
 
             friend
@@ -132,7 +280,7 @@ namespace saxion {
 
             [[nodiscard]]
             pointer operator->() const {
-                return std::addressof(_current->value);
+                return std::addressof(_current->value());
             }
 
             forward_list_iterator& operator++() {
@@ -167,13 +315,15 @@ namespace saxion {
 
         template<typename _T, typename _Nd = forward_list_node_t<_T>>
         class const_forward_list_iterator {
+        public:
             using difference_type = std::ptrdiff_t;
             using iterator_category = std::forward_iterator_tag;
             using pointer = const _T*;
             using reference = const _T&;
             using value_type = _T;
 
-            template<typename> friend
+        private:
+            template<typename, typename, typename> friend
             class ::saxion::forward_list;
 
             friend
@@ -202,7 +352,7 @@ namespace saxion {
 
             [[nodiscard]]
             pointer operator->() const {
-                return std::addressof(_current->value);
+                return std::addressof(_current->value());
             }
 
             const_forward_list_iterator& operator++() {
@@ -251,7 +401,10 @@ namespace saxion {
 
 
 
-    template<typename _T>
+    // the size policy (eager_size or lazy_size, see size_policy.h) decides whether moving ranges
+    // of nodes between lists counts them or leaves the size to be counted by the next size()
+    // the node type can be replaced by one that carries extra data, for example the ones in list_nodes.h
+    template<typename _T, typename _SizePolicy = eager_size, typename _Nd = detail::forward_list_node_t<_T>>
     class forward_list {
     public:
         using value_type = _T;
@@ -263,11 +416,26 @@ namespace saxion {
 
     private:
 
-        using node_t = detail::forward_list_node_t<_T>;
+        using node_t = _Nd;
+
+        template<typename _U, typename _P, typename _N, typename _KeyFn>
+        friend void radix_sort(forward_list<_U, _P, _N>& lst, _KeyFn key_fn);
+
+        template<typename _Iter, typename _Comp>
+        friend typename std::iterator_traits<_Iter>::value_type merge_k(_Iter first, _Iter last, _Comp comp);
 
         node_t _node;
         node_t* _tail; //not really needed but speeds things up a lot
-        size_type _size;
+        // mutable, because a lazy size is counted and cached by size()
+        mutable _SizePolicy _size;
+        // the free nodes kept by clear(clear_mode::retain)
+        detail::node_pool<node_t> _pool;
+        // the blocks that reserve() and the bulk constructors build the nodes in
+        using block_t = detail::node_block<node_t>;
+        detail::node_arena<node_t> _arena;
+        // false once a node may not live in a block, cleared conservatively: erasing doesn't set it again
+        bool _in_blocks;
+        using link_type = typename node_t::link_type;
 
         [[nodiscard]]
         node_t* head() const noexcept{
@@ -288,38 +456,33 @@ namespace saxion {
         forward_list() :
                 _node{},
                 _tail{&_node},
-                _size{0} {
+                _size{},
+                _pool{},
+                _arena{},
+                _in_blocks{true} {
             //empty forward_list has a self-referencing node!
             _node._next.reset(&_node);
             // so the _node owns itself through the _next pointer
         }
 
+        // the constructors that know the number of elements up front build all the nodes in one block
         template<typename _V>
         forward_list(std::initializer_list<_V> init_list) :
                 forward_list() {
-            for (auto item : init_list) {
-                push_back(std::move(item));
-            }
+            append_block(init_list.begin(), init_list.size());
         }
 
         // copy ctor
         forward_list(const forward_list& other) :
                 forward_list() {
-            for (node_t* other_next{other.head()};
-                 other_next->next() != other.head();
-                 other_next = other_next->next()) {
-
-                push_back(other_next->value());
-            }
+            append_block(other.begin(), other.size());
         }
 
         // copy assignment operator
         forward_list& operator=(const forward_list& other) {
             if (this != &other) {
                 clear();
-                for (auto current = other.begin(); current != other.end(); ++current) {
-                    push_back(*current);
-                }
+                append_block(other.begin(), other.size());
             }
             return *this;
         }
@@ -348,8 +511,14 @@ namespace saxion {
                         value_type >>>
         forward_list(_Iter begin, _Iter end):
                 forward_list() {
-            for (; begin != end; ++begin) {
-                push_back(*begin);
+            // the length of a single-pass range is only known at its end
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                    typename std::iterator_traits<_Iter>::iterator_category>) {
+                append_block(begin, static_cast<size_type>(std::distance(begin, end)));
+            } else {
+                for (; begin != end; ++begin) {
+                    push_back(*begin);
+                }
             }
         }
 
@@ -403,7 +572,17 @@ namespace saxion {
             std::swap(tail()->_next, other.tail()->_next);
             _node.swap(other._node);
             std::swap(_tail, other._tail);
+            // the tail of an empty list is its own sentinel, not the one it got from the other list
+            if (_tail == &other._node) {
+                _tail = &_node;
+            }
+            if (other._tail == &_node) {
+                other._tail = &other._node;
+            }
             std::swap(_size, other._size);
+            _pool.swap(other._pool);
+            _arena.swap(other._arena);
+            std::swap(_in_blocks, other._in_blocks);
         }
 
         // accessors
@@ -443,7 +622,7 @@ namespace saxion {
 
         [[nodiscard]]
         reference at(size_type index) {
-            if (index < _size) {
+            if (index < size()) {
                 node_t* current = head();
                 while (index--) { current = current->next(); }
                 return current->value();
@@ -453,7 +632,7 @@ namespace saxion {
 
         [[nodiscard]]
         const_reference at(size_type index) const {
-            if (index < _size) {
+            if (index < size()) {
                 node_t* current = head();
                 while (index--) { current = current->next(); }
                 return current->value();
@@ -464,7 +643,8 @@ namespace saxion {
         void pop_front() noexcept {
             if (begin() != end()) {
                 _node._next = std::move(_node._next->_next);
-                if (--_size == 0){
+                _size.subtract(1);
+                if (head() == &_node){
                     _tail = &_node;
                 }
             }
@@ -473,43 +653,102 @@ namespace saxion {
 
         [[nodiscard]]
         bool empty() const {
-            return _size == 0;
+            return head() == &_node;
+        }
+
+        // returns the first element that matches key, or end(). What matches is decided by the node type
+        template<typename _Key>
+        [[nodiscard]]
+        iterator find(const _Key& key) {
+            return iterator(const_cast<node_t*>(find_node(key)));
         }
 
+        template<typename _Key>
+        [[nodiscard]]
+        const_iterator find(const _Key& key) const {
+            return const_iterator(find_node(key));
+        }
+
+        // O(1), except for a lazy size after a splice: then the nodes are counted once
         [[nodiscard]]
         size_type size() const {
-            return _size;
+            if (!_size.known()) {
+                size_type n = 0;
+                for (node_t* current = head(); current != &_node; current = current->next()) {
+                    ++n;
+                }
+                _size.assign(n);
+            }
+            return _size.value();
         }
 
-        void clear() noexcept {
+        // clear_mode::retain destroys the values but keeps the nodes, so filling the list up to
+        // the same size again doesn't allocate
+        // when all the nodes live in blocks and destroying them does nothing (see list::clear), the chain
+        // is dropped as a whole without visiting the nodes
+        void clear(clear_mode mode = clear_mode::release) noexcept {
+            if constexpr (node_t::trivial_payload) {
+                if (_in_blocks && !empty()) {
+                    _node._next.release();
+                    _node._next.reset(&_node);
+                    _tail = &_node;
+                }
+            }
             if (begin() != end()) {
                 // unlink the nodes iteratively
                 while (head() != &_node) {
-                    _node._next = std::move(_node._next->_next);
-                    --_size;
+                    if (mode == clear_mode::retain && !_node._next.in_block()) {
+                        node_t* node = _node._next.release();
+                        _node._next = std::move(node->_next);
+                        _pool.recycle(node);
+                    } else {
+                        _node._next = std::move(_node._next->_next);
+                    }
                 }
                 _tail = &_node;
-                _size = 0;
             }
+            // the nodes of the blocks are gone, unless they were spliced into another list
+            _arena.release(mode == clear_mode::retain);
+            _in_blocks = true;
+            _size.assign(0);
         }
 
         ~forward_list() noexcept {
             clear();
         }
 
+        // the nodes that clear(clear_mode::retain) and reserve() keep for the next insertions
+        [[nodiscard]]
+        size_type capacity() const {
+            return size() + _pool.size() + _arena.available();
+        }
+
+        // makes sure that the list can hold n elements without allocating
+        // the missing nodes are set aside in one block, the unused ones of an earlier reserve() included
+        void reserve(size_type n) {
+            size_type current = capacity();
+            if (n > current) {
+                _arena.reserve(n - current + _arena.available());
+            }
+        }
+
+        // frees the nodes kept by clear(clear_mode::retain) and reserve()
+        // a block of reserved nodes stays until its nodes are erased and the list is cleared
+        void shrink_to_fit() noexcept {
+            _pool.release();
+            if (empty()) {
+                _arena.release();
+            }
+            _arena.forget_spare();
+        }
+
         // modifiers
         iterator push_back(_T&& value) {
-            tail()->_next = std::make_unique<node_t>(std::move(value), tail()->_next.release());
-            _tail = tail()->_next.get();
-            ++_size;
-            return iterator(tail());
+            return link_after(tail(), make_node(std::move(value), nullptr));
         }
 
         iterator push_back(const_reference value) {
-            tail()->_next = std::make_unique<node_t>(value, tail()->_next.release());
-            _tail = tail()->_next.get();
-            ++_size;
-            return iterator(tail());
+            return link_after(tail(), make_node(value, nullptr));
         }
 
         // emplace tries to construct a value in-place. It uses variadic templates
@@ -519,14 +758,17 @@ namespace saxion {
         // emplace_back(5, 'a'). Emplace then uses the arguments passed to it to call a string constructor:
         // by calling _T(std::forward<Args>(args)...) which in this example becomes :
         // std::string(5, 'a')
-        // notice that we are actually constructing _T in this function and passing it to the node_t ctor
-        // normally, the node_t ctor would also be overloaded for taking a list of parameters to create objects in-place
+        // the arguments are passed on to the piecewise constructor of the node (the one that takes
+        // std::in_place), which constructs _T right inside the node: no temporary is made and moved,
+        // so even a type that can't be copied or moved can be stored
         template<typename... Args>
         iterator emplace_back(Args&& ... args) {
-            tail()->_next = std::make_unique<node_t>(_T(std::forward<Args>(args)...),  tail()->_next.release());
-            _tail = tail()->_next.get();
-            ++_size;
-            return iterator(tail());
+            return link_after(tail(), make_node(std::in_place, nullptr, std::forward<Args>(args)...));
+        }
+
+        template<typename... Args>
+        iterator emplace_front(Args&& ... args) {
+            return emplace_after(before_begin(), std::forward<Args>(args)...);
         }
 
         // instead of writing two overloads that take an l-value and an r-value references
@@ -534,22 +776,18 @@ namespace saxion {
         // the compiler will make the two overloads from it for us
         template<typename V>
         iterator push_front(V&& value) {
-            _node._next = std::make_unique<node_t>(std::forward<V>(value), _node._next.release());
-            if (_size++ == 0){
-                _tail = _node.next();
-            }
-            return iterator(head());
+            return link_after(&_node, make_node(std::forward<V>(value), nullptr));
         }
 
 
         iterator erase_after(iterator pos) {
             if (begin() != end()){
                 auto res(pos.node()->next()->next());
-                pos.node()->_next = std::move(pos.node()->_next->_next);
-                --_size;
-                if (res == &_node){
-                    _tail = &_node;
+                if (pos.node()->next() == _tail){
+                    _tail = pos.node();
                 }
+                pos.node()->_next = std::move(pos.node()->_next->_next);
+                _size.subtract(1);
                 return iterator(res);
             }
             return end();
@@ -558,29 +796,518 @@ namespace saxion {
         // insert element after pos
         // returns iterator to inserted element
         iterator insert_after(iterator pos, const_reference value) {
-            // grab previous element?
-            pos.node()->_next = std::make_unique<node_t>(value, pos.node()->_next.release());
-            if(_size++ == 0){
-                _tail = pos.node()->next();
-            }
-            return iterator(pos.node()->next());
+            return link_after(pos.node(), make_node(value, nullptr));
         }
 
         iterator insert_after(iterator pos, _T&& value) {
-            pos.node()->_next = std::make_unique<node_t>(std::move(value), pos.node()->_next.release());
-            if(_size++ == 0){
-                _tail = pos.node()->next();
-            }
-            return iterator(pos.node()->next());
+            return link_after(pos.node(), make_node(std::move(value), nullptr));
         }
 
         template<typename... Args>
         iterator emplace_after(iterator pos, Args&& ... args) {
-            pos.node()->_next = std::make_unique<node_t>(_T(std::forward<Args>(args)...), pos.node()->_next.release());
-            if(_size++ == 0){
-                _tail = pos.node()->next();
+            return link_after(pos.node(), make_node(std::in_place, nullptr, std::forward<Args>(args)...));
+        }
+
+        // inserts copies of [first, last) after pos and returns an iterator to the last of them, or pos
+        // when the range is empty. The nodes are made first and then linked in one go: a throwing copy
+        // leaves the list as it was, and the size and the tail are updated once
+        template<typename _Iter, typename = typename std::iterator_traits<_Iter>::iterator_category>
+        iterator insert_after(iterator pos, _Iter first, _Iter last) {
+            chain created = make_chain(first, last);
+            if (!created.head) {
+                return pos;
+            }
+            node_t* back = created.tail;
+            back->_next = std::move(pos.node()->_next);
+            pos.node()->_next = std::move(created.head);
+            if (pos.node() == _tail) {
+                _tail = back;
+            }
+            _size.add(created.length);
+            return iterator(back);
+        }
+
+        iterator insert_after(iterator pos, std::initializer_list<_T> values) {
+            return insert_after(pos, values.begin(), values.end());
+        }
+
+        // appends the elements of anything that std::begin and std::end work on
+        template<typename _Range>
+        void append_range(_Range&& range) {
+            insert_after(iterator(_tail), std::begin(range), std::end(range));
+        }
+
+        // replaces the elements by copies of [first, last). The values of the existing nodes are
+        // assigned to, only the difference in length is allocated or freed
+        template<typename _Iter, typename = typename std::iterator_traits<_Iter>::iterator_category>
+        void assign(_Iter first, _Iter last) {
+            iterator prev = before_begin();
+            for (iterator current = begin(); current != end() && first != last; ++current, ++first) {
+                current.node()->assign(*first);
+                prev = current;
+            }
+            if (first == last) {
+                erase_after(prev, end());
+            } else {
+                insert_after(prev, first, last);
+            }
+        }
+
+        void assign(std::initializer_list<_T> values) {
+            assign(values.begin(), values.end());
+        }
+
+        // removes the elements in (pos, last) and returns last. The range is unlinked in one go,
+        // after which its nodes are destroyed one after the other
+        iterator erase_after(iterator pos, iterator last) {
+            if (pos.node()->next() == last.node()) {
+                return last;
+            }
+            size_type removed = 1;
+            node_t* back = pos.node()->next();
+            for (; back->next() != last.node(); back = back->next()) {
+                ++removed;
+            }
+            link_type range = std::move(pos.node()->_next);
+            pos.node()->_next = std::move(back->_next);
+            if (back == _tail) {
+                _tail = pos.node();
+            }
+            while (range) {
+                range = std::move(range->_next);
+            }
+            _size.subtract(removed);
+            return last;
+        }
+
+        // removes the first n elements, or all of them when there are fewer
+        void pop_front_n(size_type n) {
+            iterator last = begin();
+            for (; n && last != end(); --n) {
+                ++last;
+            }
+            erase_after(before_begin(), last);
+        }
+
+        // removes the last n elements, or all of them when there are fewer
+        // O(size()): the new last element is found by walking from the front
+        void pop_back_n(size_type n) {
+            size_type length = size();
+            iterator pos = before_begin();
+            for (size_type kept = n < length ? length - n : 0; kept; --kept) {
+                ++pos;
+            }
+            erase_after(pos, end());
+        }
+
+        // frees at most budget elements from the front, for a caller that spreads the teardown of a huge
+        // list over several calls. Returns true once the list is empty
+        bool clear_incremental(size_type budget) {
+            if constexpr (node_t::trivial_payload) {
+                if (_in_blocks) {
+                    clear();
+                    return true;
+                }
+            }
+            pop_front_n(budget);
+            if (empty()) {
+                clear();
+                return true;
+            }
+            return false;
+        }
+
+        // leaves the list empty in O(1) and hands the detached nodes to the background reclaimer
+        // (see reclaimer.h), the values are destroyed on that thread. The retained nodes stay with
+        // the list, the reserved ones go with the detached nodes
+        void detach_and_reclaim() {
+            if (empty()) {
+                return;
+            }
+            if constexpr (node_t::trivial_payload) {
+                if (_in_blocks) {
+                    clear();
+                    return;
+                }
+            }
+            auto detached = std::make_unique<reclaimer::holder<forward_list>>();
+            detached->value.swap(*this);
+            _pool.swap(detached->value._pool);
+            reclaimer::instance().post(std::move(detached));
+        }
+
+        // removes the elements for which pred is true and returns how many. One pass that relinks the
+        // kept nodes; the removed ones are freed together at the end, so value may refer to an element
+        // of the list. When pred throws, the elements it had already picked are removed
+        template<typename _Pred>
+        size_type remove_if(_Pred pred) {
+            return drop_nodes([&pred](const node_t*, node_t* node) { return pred(node->value()); });
+        }
+
+        template<typename _V>
+        size_type remove(const _V& value) {
+            return remove_if([&value](const _T& element) { return element == value; });
+        }
+
+        // removes every element that pred finds equal to the element kept before it, of a run of
+        // equal elements only the first one stays. Returns the number of removed elements
+        template<typename _BinaryPred>
+        size_type unique(_BinaryPred pred) {
+            return drop_nodes([&pred](const node_t* kept, node_t* node) {
+                return kept && pred(kept->value(), node->value());
+            });
+        }
+
+        size_type unique() {
+            return unique(std::equal_to<>());
+        }
+
+        // reverses the order of the elements by relinking the nodes, O(n)
+        void reverse() noexcept {
+            if (head() == tail()) {
+                return;
+            }
+            node_t* new_tail = head();
+            tail()->_next.release();
+            link_type input = std::move(_node._next);
+            link_type reversed;
+            while (input) {
+                link_type rest = std::move(input->_next);
+                input->_next = std::move(reversed);
+                reversed = std::move(input);
+                input = std::move(rest);
+            }
+            _node._next = std::move(reversed);
+            new_tail->_next.reset(&_node);
+            _tail = new_tail;
+        }
+
+        // moves the elements for which pred is true in front of the others. Like the _after functions
+        // it returns the position before the first of the others: the last element for which pred is
+        // true, or before_begin(). One pass that relinks the nodes into two chains, the order within
+        // each group stays. When pred throws, the elements it had already picked come first
+        template<typename _Pred>
+        iterator stable_partition(_Pred pred) {
+            if (empty()) {
+                return before_begin();
+            }
+            tail()->_next.release();
+            link_type input = std::move(_node._next);
+            link_type picked;
+            node_t* picked_tail = nullptr;
+            link_type others;
+            node_t* others_tail = nullptr;
+            try {
+                while (input) {
+                    node_t* node = input.get();
+                    bool first_group = pred(std::as_const(node->value()));
+                    link_type rest = std::move(node->_next);
+                    if (first_group) {
+                        append(picked, picked_tail, std::move(input));
+                    } else {
+                        append(others, others_tail, std::move(input));
+                    }
+                    input = std::move(rest);
+                }
+            } catch (...) {
+                // the nodes that were not looked at go in front of the others
+                node_t* input_tail = input.get();
+                while (input_tail && input_tail->next()) {
+                    input_tail = input_tail->next();
+                }
+                if (input_tail) {
+                    input_tail->_next = std::move(others);
+                    others = std::move(input);
+                    others_tail = others_tail ? others_tail : input_tail;
+                }
+                adopt_chains(std::move(picked), picked_tail, std::move(others), others_tail);
+                throw;
+            }
+            adopt_chains(std::move(picked), picked_tail, std::move(others), others_tail);
+            return picked_tail ? iterator(picked_tail) : before_begin();
+        }
+
+        // the same as stable_partition(), relinking keeps the order anyway
+        template<typename _Pred>
+        iterator partition(_Pred pred) {
+            return stable_partition(std::move(pred));
+        }
+
+        // moves all the elements of other after pos, O(1): the size of other is taken over as a whole
+        void splice_after(iterator pos, forward_list& other) {
+            if (&other == this || other.empty()) {
+                return;
+            }
+            _arena.share(other._arena);
+            _in_blocks = _in_blocks && other._in_blocks;
+            if (other._size.known()) {
+                _size.add(other._size.value());
+            } else {
+                _size.invalidate();
+            }
+            other._size.assign(0);
+            node_t* last_node = other._tail;
+            auto range = std::move(other._node._next);
+            // other's sentinel owns itself again
+            other._node._next = std::move(last_node->_next);
+            other._tail = &other._node;
+            if (_tail == pos.node()) {
+                _tail = last_node;
+            }
+            last_node->_next = std::move(pos.node()->_next);
+            pos.node()->_next = std::move(range);
+        }
+
+        // moves the elements (before_first, last] of other after pos, other may be this list
+        // unlike std::forward_list the last element is included: a singly-linked list can't reach the node
+        // in front of an exclusive end in O(1). The nodes are relinked, not copied. O(1) with a lazy size
+        // policy; an eager size policy has to count the moved elements
+        void splice_after(iterator pos, forward_list& other, iterator before_first, iterator last) {
+            if (before_first == last) {
+                return;
+            }
+            node_t* first_node = before_first.node()->next();
+            node_t* last_node = last.node();
+            if (&other != this) {
+                _arena.share(other._arena);
+                _in_blocks = _in_blocks && other._in_blocks;
+                if constexpr (_SizePolicy::counts_ranges) {
+                    size_type moved = 1;
+                    for (node_t* current = first_node; current != last_node; current = current->next()) {
+                        ++moved;
+                    }
+                    other._size.subtract(moved);
+                    _size.add(moved);
+                } else {
+                    other._size.invalidate();
+                    _size.invalidate();
+                }
+            }
+            // take the range out of other
+            if (other._tail == last_node) {
+                other._tail = before_first.node();
+            }
+            auto range = std::move(before_first.node()->_next);
+            before_first.node()->_next = std::move(last_node->_next);
+            // and link it after pos
+            if (_tail == pos.node()) {
+                _tail = last_node;
+            }
+            last_node->_next = std::move(pos.node()->_next);
+            pos.node()->_next = std::move(range);
+        }
+
+        // moves the elements after pos into a new list, which is returned
+        // O(1) with a lazy size policy, an eager one counts the moved elements
+        forward_list split_after(iterator pos) {
+            forward_list result;
+            if (pos.node() == _tail) {
+                return result;
+            }
+            node_t* first_node = pos.node()->next();
+            result._arena.share(_arena);
+            result._in_blocks = _in_blocks;
+            if constexpr (_SizePolicy::counts_ranges) {
+                size_type moved = 0;
+                for (node_t* current = first_node; current != &_node; current = current->next()) {
+                    ++moved;
+                }
+                _size.subtract(moved);
+                result._size.assign(moved);
+            } else {
+                _size.invalidate();
+                result._size.invalidate();
+            }
+            auto range = std::move(pos.node()->_next);
+            // the new last node of this list owns the sentinel again
+            pos.node()->_next = std::move(_tail->_next);
+            _tail->_next = std::move(result._node._next);
+            result._tail = _tail;
+            result._node._next = std::move(range);
+            _tail = pos.node();
+            return result;
+        }
+
+    private:
+
+        // appends the n values that first points to. The nodes are built in one block and linked in a
+        // single pass: one allocation instead of n, and no tail update per element
+        template<typename _Iter>
+        void append_block(_Iter first, size_type n) {
+            if (n == 0) {
+                return;
+            }
+            auto block = std::make_shared<block_t>(n);
+            size_type built = 0;
+            try {
+                // every new node is linked to the one before it right away, the block is written once
+                for (; built < n; ++built, ++first) {
+                    node_t* node = block->construct(built, *first, nullptr);
+                    if (built > 0) {
+                        block->at(built - 1)->_next = link_type(node, true);
+                    }
+                }
+            } catch (...) {
+                // the links would destroy the nodes a second time
+                for (size_type i = 0; i < built; ++i) {
+                    block->at(i)->_next.release();
+                }
+                block->destroy(built);
+                throw;
+            }
+            // the last new node takes over the sentinel from the tail
+            block->at(n - 1)->_next = std::move(tail()->_next);
+            tail()->_next = link_type(block->at(0), true);
+            _tail = block->at(n - 1);
+            _size.add(n);
+            _arena.adopt(std::move(block));
+        }
+
+        // nodes that are made before they are linked into the list, see insert_after(pos, first, last)
+        // the chain is destroyed iteratively when it is not linked, e.g. when a copy threw
+        struct chain {
+            link_type head;
+            node_t* tail = nullptr;
+            size_type length = 0;
+
+            chain() = default;
+
+            chain(chain&&) noexcept = default;
+
+            ~chain() noexcept {
+                while (head) {
+                    head = std::move(head->_next);
+                }
+            }
+        };
+
+        template<typename _Iter>
+        chain make_chain(_Iter first, _Iter last) {
+            chain result;
+            for (; first != last; ++first) {
+                link_type created = make_node(*first, nullptr);
+                node_t* node = created.get();
+                if (result.tail) {
+                    result.tail->_next = std::move(created);
+                } else {
+                    result.head = std::move(created);
+                }
+                result.tail = node;
+                ++result.length;
+            }
+            return result;
+        }
+
+        // a node for an insertion: in a slot that reserve() set aside, or else from the pool
+        template<typename... Args>
+        link_type make_node(Args&& ... args) {
+            if (_arena.available()) {
+                return node_t::block_link(_arena.make(std::forward<Args>(args)...));
+            }
+            _in_blocks = false;
+            return _pool.make(std::forward<Args>(args)...);
+        }
+
+        // links the new node created in after pos. The node is made with an empty link before the list is
+        // touched, so a value that throws while it is constructed leaves the list as it was
+        iterator link_after(node_t* pos, link_type created) noexcept {
+            node_t* node = created.get();
+            node->_next = std::move(pos->_next);
+            pos->_next = std::move(created);
+            if (_tail == pos) {
+                _tail = node;
+            }
+            _size.add(1);
+            return iterator(node);
+        }
+
+        // appends node, which links to nothing, to the chain that starts at head
+        static void append(link_type& head, node_t*& chain_tail, link_type node) noexcept {
+            node_t* last = node.get();
+            if (chain_tail) {
+                chain_tail->_next = std::move(node);
+            } else {
+                head = std::move(node);
+            }
+            chain_tail = last;
+        }
+
+        // makes the chains first and second, which link to nothing at their ends, the content of the list
+        void adopt_chains(link_type first, node_t* first_tail, link_type second, node_t* second_tail) noexcept {
+            if (second) {
+                append(first, first_tail, std::move(second));
+                first_tail = second_tail;
+            }
+            if (first_tail) {
+                first_tail->_next.reset(&_node);
+                _node._next = std::move(first);
+                _tail = first_tail;
+            } else {
+                _node._next.reset(&_node);
+                _tail = &_node;
+            }
+        }
+
+        // relinks the nodes for which drop(last kept node or nullptr, node) is false and frees the
+        // others in one batch at the end. Returns the number of freed nodes
+        template<typename _Drop>
+        size_type drop_nodes(_Drop drop) {
+            if (empty()) {
+                return 0;
+            }
+            tail()->_next.release();
+            link_type input = std::move(_node._next);
+            link_type kept;
+            node_t* kept_tail = nullptr;
+            link_type dropped;
+            node_t* dropped_tail = nullptr;
+            size_type count = 0;
+            try {
+                while (input) {
+                    node_t* node = input.get();
+                    bool dropping = drop(static_cast<const node_t*>(kept_tail), node);
+                    link_type rest = std::move(node->_next);
+                    if (dropping) {
+                        append(dropped, dropped_tail, std::move(input));
+                        ++count;
+                    } else {
+                        append(kept, kept_tail, std::move(input));
+                    }
+                    input = std::move(rest);
+                }
+            } catch (...) {
+                node_t* input_tail = input.get();
+                while (input_tail && input_tail->next()) {
+                    input_tail = input_tail->next();
+                }
+                adopt_chains(std::move(kept), kept_tail, std::move(input), input_tail);
+                _size.subtract(count);
+                free_chain(std::move(dropped));
+                throw;
+            }
+            adopt_chains(std::move(kept), kept_tail, link_type(), nullptr);
+            _size.subtract(count);
+            free_chain(std::move(dropped));
+            return count;
+        }
+
+        // destroys the nodes of an owned chain iteratively
+        static void free_chain(link_type chain) noexcept {
+            while (chain) {
+                chain = std::move(chain->_next);
+            }
+        }
+
+        template<typename _Key>
+        [[nodiscard]]
+        const node_t* find_node(const _Key& key) const {
+            const auto& probe = node_t::probe(key);
+            for (const node_t* node = head(); node != &_node; node = node->next()) {
+                if (node->matches(probe)) {
+                    return node;
+                }
             }
-            return iterator(pos.node()->next());
+            return &_node;
         }
 
     };
@@ -593,11 +1320,369 @@ namespace saxion {
 
     forward_list(std::initializer_list<const char*>) -> forward_list<std::string>;
 
+    namespace detail {
+
+        // the chains that radix_sort deals the nodes out over. The nodes are cut in lanes that are dealt
+        // out side by side, each lane into its own 256 buckets: the reads of the scattered nodes of the
+        // different lanes overlap instead of waiting for each other. Bucket d of one lane goes before
+        // bucket d of the next lane, which keeps the sort stable
+        template<typename _Nd>
+        struct radix_lanes {
+            using link_type = typename _Nd::link_type;
+
+            static constexpr std::size_t lanes = 16;
+            static constexpr std::size_t buckets = 256;
+
+            // nodes linked by _next, the last one links to nothing
+            struct chain {
+                link_type head;
+                _Nd* tail = nullptr;
+                std::size_t length = 0;
+
+                // node links to nothing
+                void push(link_type node) noexcept {
+                    _Nd* last = node.get();
+                    if (tail) {
+                        tail->_next = std::move(node);
+                    } else {
+                        head = std::move(node);
+                    }
+                    tail = last;
+                    ++length;
+                }
+
+                void append(chain& other) noexcept {
+                    if (!other.head) {
+                        return;
+                    }
+                    if (tail) {
+                        tail->_next = std::move(other.head);
+                    } else {
+                        head = std::move(other.head);
+                    }
+                    tail = other.tail;
+                    length += other.length;
+                    other.tail = nullptr;
+                    other.length = 0;
+                }
+            };
+
+            chain input[lanes];
+            chain output[lanes][buckets];
+
+            // cuts chain, of n nodes, in lanes of about the same length
+            void split(link_type chain_head, std::size_t n) noexcept {
+                for (std::size_t lane = 0; lane < lanes; ++lane) {
+                    std::size_t length = (lane + 1) * n / lanes - lane * n / lanes;
+                    if (length == 0) {
+                        continue;
+                    }
+                    _Nd* last = chain_head.get();
+                    for (std::size_t i = 1; i < length; ++i) {
+                        last = last->next();
+                    }
+                    link_type rest = std::move(last->_next);
+                    input[lane].head = std::move(chain_head);
+                    input[lane].tail = last;
+                    input[lane].length = length;
+                    chain_head = std::move(rest);
+                }
+            }
+
+            // moves every node of the lanes to the bucket that digit(node) returns, one node per lane in turn
+            // when digit throws, the nodes that were not dealt out yet are still in the lanes
+            template<typename _Digit>
+            void deal(_Digit& digit) {
+                bool busy = true;
+                while (busy) {
+                    busy = false;
+                    for (std::size_t lane = 0; lane < lanes; ++lane) {
+                        chain& in = input[lane];
+                        if (!in.head) {
+                            continue;
+                        }
+                        busy = true;
+                        _Nd* node = in.head.get();
+                        std::size_t bucket = digit(node);
+                        link_type rest = std::move(node->_next);
+                        prefetch(rest.get());
+                        output[lane][bucket].push(std::move(in.head));
+                        in.head = std::move(rest);
+                        if (!in.head) {
+                            in.tail = nullptr;
+                        }
+                        --in.length;
+                    }
+                }
+            }
+
+            // puts the buckets back in the lanes for the next pass, in order and about n / lanes nodes per lane
+            void regroup(std::size_t n) noexcept {
+                std::size_t lane = 0;
+                std::size_t filled = 0;
+                for (std::size_t bucket = 0; bucket < buckets; ++bucket) {
+                    for (auto& from : output) {
+                        while (lane + 1 < lanes && filled >= (lane + 1) * n / lanes) {
+                            ++lane;
+                        }
+                        filled += from[bucket].length;
+                        input[lane].append(from[bucket]);
+                    }
+                }
+            }
+
+            // all the nodes in one chain: in order after regroup(), in some order after deal() threw
+            chain gather() noexcept {
+                chain all;
+                for (auto& in : input) {
+                    all.append(in);
+                }
+                for (std::size_t bucket = 0; bucket < buckets; ++bucket) {
+                    for (auto& from : output) {
+                        all.append(from[bucket]);
+                    }
+                }
+                return all;
+            }
+        };
+    }
+
+    // sorts lst by the integral key that key_fn returns for a value, an LSD radix sort: every pass
+    // deals the nodes out over 256 buckets by one byte of the key, keeping their order, and strings
+    // the buckets together again. Only the links change, no value is moved and nothing is allocated.
+    // Stable, O(n) per byte of the key; the bytes in which all keys are equal are skipped
+    // when key_fn throws, all the elements are still in the list, in an unspecified order
+    template<typename _T, typename _SizePolicy, typename _Nd, typename _KeyFn>
+    void radix_sort(forward_list<_T, _SizePolicy, _Nd>& lst, _KeyFn key_fn) {
+        using node_t = _Nd;
+        using key_type = std::decay_t<std::invoke_result_t<_KeyFn&, const _T&>>;
+        static_assert(std::is_integral_v<key_type>, "radix_sort needs an integral key");
+        using bits_type = std::make_unsigned_t<key_type>;
+        // a signed key sorts as unsigned once its sign bit is flipped
+        constexpr bits_type flip = std::is_signed_v<key_type> ? bits_type(bits_type{1} << (sizeof(bits_type) * 8 - 1)) : 0;
+        auto bits = [&key_fn](const node_t* node) {
+            return static_cast<bits_type>(static_cast<bits_type>(key_fn(node->value())) ^ flip);
+        };
+
+        node_t* head = lst.head();
+        if (head == &lst._node || head == lst.tail()) {
+            return;
+        }
+        // the bytes in which the keys differ, the others don't change the order
+        bits_type first = bits(head);
+        bits_type differ = 0;
+        for (const node_t* node = head; node != &lst._node; node = node->next()) {
+            differ |= bits(node) ^ first;
+        }
+        if (differ == 0) {
+            return;
+        }
+
+        // while the nodes are sorted they are not linked to the sentinel
+        std::size_t n = lst.size();
+        lst.tail()->_next.release();
+        // 16 lanes of 256 buckets, about 100 KiB of links on the stack
+        detail::radix_lanes<node_t> lanes;
+        lanes.split(std::move(lst._node._next), n);
+        try {
+            for (std::size_t shift = 0; shift < sizeof(bits_type) * 8; shift += 8) {
+                if (((differ >> shift) & 0xffu) == 0) {
+                    continue;
+                }
+                auto digit = [&bits, shift](const node_t* node) {
+                    return static_cast<std::size_t>((bits(node) >> shift) & 0xffu);
+                };
+                lanes.deal(digit);
+                lanes.regroup(n);
+            }
+        } catch (...) {
+            auto all = lanes.gather();
+            all.tail->_next.reset(&lst._node);
+            lst._node._next = std::move(all.head);
+            lst._tail = all.tail;
+            throw;
+        }
+        auto all = lanes.gather();
+        all.tail->_next.reset(&lst._node);
+        lst._node._next = std::move(all.head);
+        lst._tail = all.tail;
+    }
+
+    namespace detail {
+
+        // a tournament tree over the heads of k sorted chains that keeps the loser of every match: after
+        // the winner is taken, only the matches on the path from its chain to the root are played again,
+        // log k comparisons. An empty chain loses every match, a tie goes to the lower chain
+        template<typename _Nd, typename _Comp>
+        class loser_tree {
+        public:
+            using link_type = typename _Nd::link_type;
+
+            loser_tree(std::vector<link_type>& heads, _Comp& comp) :
+                    _heads{heads},
+                    _comp{comp},
+                    _tree(heads.size()) {
+                if (!_tree.empty()) {
+                    _tree[0] = play(1);
+                }
+            }
+
+            // the chain with the smallest head, the first one when there are several
+            [[nodiscard]]
+            std::size_t winner() const noexcept {
+                return _tree[0];
+            }
+
+            // the head of the winner changed: plays its matches again
+            void replay() {
+                std::size_t k = _tree.size();
+                std::size_t winner = _tree[0];
+                for (std::size_t match = (k + winner) / 2; match > 0; match /= 2) {
+                    if (beats(_tree[match], winner)) {
+                        std::swap(_tree[match], winner);
+                    }
+                }
+                _tree[0] = winner;
+            }
+
+        private:
+            std::vector<link_type>& _heads;
+            _Comp& _comp;
+            // _tree[0] is the winner, _tree[1..k) the losers of the matches; match m is played by the
+            // winners of 2m and 2m + 1, and position k + i is chain i
+            std::vector<std::size_t> _tree;
+
+            [[nodiscard]]
+            bool beats(std::size_t a, std::size_t b) {
+                if (!_heads[b]) {
+                    return true;
+                }
+                if (!_heads[a]) {
+                    return false;
+                }
+                return a < b ? !_comp(_heads[b]->value(), _heads[a]->value())
+                             : _comp(_heads[a]->value(), _heads[b]->value());
+            }
+
+            // plays the matches below position, returns the winner
+            std::size_t play(std::size_t position) {
+                std::size_t k = _tree.size();
+                if (position >= k) {
+                    return position - k;
+                }
+                std::size_t left = play(2 * position);
+                std::size_t right = play(2 * position + 1);
+                if (beats(right, left)) {
+                    std::swap(left, right);
+                }
+                _tree[position] = right;
+                return left;
+            }
+        };
+    }
+
+    // merges the sorted forward_lists in [first, last) into one sorted list, the lists end up empty.
+    // The next node is picked with a loser tree over the heads of the lists, O(n log k) comparisons
+    // for k lists. The nodes are relinked, no value is moved, only the tree of k entries is allocated.
+    // Stable: of equal elements, the ones of an earlier list come first
+    // when comp throws, all the elements are in the first of the lists that wasn't empty, in an unspecified
+    // order, and the other lists are left empty
+    template<typename _Iter, typename _Comp>
+    typename std::iterator_traits<_Iter>::value_type merge_k(_Iter first, _Iter last, _Comp comp) {
+        using list_type = typename std::iterator_traits<_Iter>::value_type;
+        using node_t = typename list_type::node_t;
+        using link_type = typename node_t::link_type;
+
+        list_type result;
+        // the first list that wasn't empty, it gets the elements back when comp throws
+        list_type* keeper = nullptr;
+        std::vector<link_type> heads;
+        bool sizes_known = true;
+        typename list_type::size_type total = 0;
+        for (; first != last; ++first) {
+            list_type& lst = *first;
+            if (lst.empty()) {
+                continue;
+            }
+            if (!keeper) {
+                keeper = &lst;
+            }
+            result._arena.share(lst._arena);
+            result._in_blocks = result._in_blocks && lst._in_blocks;
+            sizes_known = sizes_known && lst._size.known();
+            total += lst._size.value();
+            // the chain of the list links to nothing at its end
+            lst.tail()->_next.release();
+            heads.push_back(std::move(lst._node._next));
+            lst._node._next.reset(&lst._node);
+            lst._tail = &lst._node;
+            lst._size.assign(0);
+        }
+        if (sizes_known) {
+            result._size.assign(total);
+        } else {
+            result._size.invalidate();
+        }
+        if (heads.empty()) {
+            return result;
+        }
+
+        // the merged chain hangs from the sentinel of the result, which gets its link back at the end
+        result._node._next.release();
+        node_t* tail = &result._node;
+        try {
+            detail::loser_tree<node_t, _Comp> tree(heads, comp);
+            for (std::size_t winner = tree.winner(); heads[winner]; winner = tree.winner()) {
+                link_type& head = heads[winner];
+                node_t* node = head.get();
+                link_type next = std::move(node->_next);
+                detail::prefetch(next.get());
+                tail->_next = std::move(head);
+                tail = node;
+                head = std::move(next);
+                tree.replay();
+            }
+        } catch (...) {
+            // the rest of the chains goes behind the merged nodes
+            for (auto& head : heads) {
+                if (head) {
+                    tail->_next = std::move(head);
+                    while (tail->next()) {
+                        tail = tail->next();
+                    }
+                }
+            }
+            // and the whole chain goes back to the keeper, which still has its own pool and reserved nodes
+            keeper->_arena.share(result._arena);
+            keeper->_in_blocks = keeper->_in_blocks && result._in_blocks;
+            keeper->_node._next.release();
+            keeper->_node._next = std::move(result._node._next);
+            tail->_next.reset(&keeper->_node);
+            keeper->_tail = tail;
+            if (sizes_known) {
+                keeper->_size.assign(total);
+            } else {
+                keeper->_size.invalidate();
+            }
+            result._node._next.reset(&result._node);
+            result._size.assign(0);
+            throw;
+        }
+        tail->_next.reset(&result._node);
+        result._tail = tail;
+        return result;
+    }
+
+    template<typename _Iter>
+    typename std::iterator_traits<_Iter>::value_type merge_k(_Iter first, _Iter last) {
+        return merge_k(first, last, std::less<>());
+    }
+
 }
 
 namespace std{
-    template<typename _T>
-    inline void swap(saxion::forward_list<_T>& x, saxion::forward_list <_T>& y) noexcept {
+    template<typename _T, typename _SizePolicy, typename _Nd>
+    inline void swap(saxion::forward_list<_T, _SizePolicy, _Nd>& x, saxion::forward_list <_T, _SizePolicy, _Nd>& y) noexcept {
         x.swap(y);
     }
 }
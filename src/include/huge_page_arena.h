@@ -0,0 +1,397 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef INCLUDE_HUGE_PAGE_ARENA_H
+#define INCLUDE_HUGE_PAGE_ARENA_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace saxion {
+
+    // asks for transparent huge pages for the whole huge pages within [memory, memory + bytes), for a
+    // big block of nodes that is about to be written: one page fault per 2 MiB instead of per 4 KiB
+    inline void advise_huge_pages(void* memory, std::size_t bytes) noexcept {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        constexpr std::uintptr_t huge_page = std::uintptr_t{2} << 20u;
+        auto begin = (reinterpret_cast<std::uintptr_t>(memory) + huge_page - 1) / huge_page * huge_page;
+        auto end = (reinterpret_cast<std::uintptr_t>(memory) + bytes) / huge_page * huge_page;
+        if (begin < end) {
+            ::madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+        }
+#else
+        (void) memory;
+        (void) bytes;
+#endif
+    }
+
+    // a source of node memory for very large lists: one big reservation of address space that is
+    // handed out in node-sized slots, from the front to the back. On Linux the reservation asks for
+    // transparent huge pages (madvise(MADV_HUGEPAGE)), so a traversal over millions of nodes needs
+    // one TLB entry per 2 MiB instead of one per 4 KiB. When the reservation fails, or is used up,
+    // the arena falls back to ::operator new, and without huge pages it still works on normal pages.
+    // Freed slots are kept for the next allocations, the memory goes back to the system only when
+    // the arena is destroyed.
+    // Safe to use from several threads: a thread takes the slots for single nodes from a cache of its
+    // own, a slab of the reservation and the slots it freed, without locking. Only refilling the cache
+    // (once per slab), handing back a surplus of freed slots and allocating a block of nodes lock the
+    // arena. The slots a thread has cached when it ends go back to the arena
+    class huge_page_arena {
+    public:
+        using size_type = std::size_t;
+
+        static constexpr size_type huge_page_size = size_type{2} << 20u;
+        // the address space that is reserved, it only costs memory once it is used
+        static constexpr size_type default_reservation = size_type{64} << 30u;
+        // the reservation is made usable in steps of this size
+        static constexpr size_type commit_step = 16 * huge_page_size;
+        // a thread takes the slots for single nodes from the reservation in slabs of about this size
+        static constexpr size_type slab_size = size_type{64} << 10u;
+
+        explicit huge_page_arena(size_type slot_size, size_type reservation = default_reservation) :
+                _slot_size{slot_size < sizeof(free_slot) ? sizeof(free_slot) : slot_size},
+                _slab_slots{std::max<size_type>(1, slab_size / _slot_size)},
+                _id{next_id()},
+                _base{nullptr},
+                _reserved{0},
+                _committed{0},
+                _used{0},
+                _huge_pages{false},
+                _free{nullptr} {
+            {
+                std::lock_guard<std::mutex> lock(registry_mutex());
+                registry().push_back(this);
+            }
+#if defined(__linux__)
+            // reserve one huge page extra, so the start can be aligned to a huge page
+            size_type length = round_up(reservation, huge_page_size) + huge_page_size;
+            void* mapped = ::mmap(nullptr, length, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+            if (mapped == MAP_FAILED) {
+                return;
+            }
+            auto address = reinterpret_cast<std::uintptr_t>(mapped);
+            auto aligned = round_up(address, huge_page_size);
+            if (aligned != address) {
+                ::munmap(mapped, aligned - address);
+            }
+            ::munmap(reinterpret_cast<void*>(aligned + length - huge_page_size), huge_page_size - (aligned - address));
+            _base = reinterpret_cast<char*>(aligned);
+            _reserved = length - huge_page_size;
+#if defined(MADV_HUGEPAGE)
+            _huge_pages = ::madvise(_base, _reserved, MADV_HUGEPAGE) == 0;
+#endif
+#else
+            (void) reservation;
+#endif
+        }
+
+        huge_page_arena(const huge_page_arena&) = delete;
+
+        huge_page_arena& operator=(const huge_page_arena&) = delete;
+
+        // the caches that threads still have of this arena are dropped by those threads
+        ~huge_page_arena() noexcept {
+            {
+                std::lock_guard<std::mutex> lock(registry_mutex());
+                auto& live = registry();
+                live.erase(std::find(live.begin(), live.end(), this));
+            }
+#if defined(__linux__)
+            if (_base) {
+                ::munmap(_base, _reserved);
+            }
+#endif
+        }
+
+        // the arena of a node type. It is never destroyed: lists with a static lifetime may still
+        // free their nodes after the end of main
+        template<typename _Nd>
+        static huge_page_arena& of() {
+            static auto* arena = new huge_page_arena(sizeof(_Nd));
+            return *arena;
+        }
+
+        // bytes is a multiple of the slot size: one slot for a node, more for a block of nodes
+        void* allocate(size_type bytes) {
+            thread_cache* cache = bytes == _slot_size ? cache_of_this_thread() : nullptr;
+            if (cache && (cache->free || cache->next != cache->end || refill(*cache))) {
+                if (cache->free) {
+                    free_slot* slot = cache->free;
+                    cache->free = slot->next;
+                    --cache->free_count;
+                    return slot;
+                }
+                void* result = cache->next;
+                cache->next += _slot_size;
+                return result;
+            }
+            std::lock_guard<std::mutex> lock(_mutex);
+            // without a cache: after the caches of the thread were destroyed, or when refill() failed
+            if (bytes == _slot_size && _free) {
+                free_slot* slot = _free;
+                _free = slot->next;
+                return slot;
+            }
+            if (!commit(bytes)) {
+                return ::operator new(bytes);
+            }
+            void* result = _base + _used;
+            _used += bytes;
+            return result;
+        }
+
+        void deallocate(void* memory, size_type bytes) noexcept {
+            if (!owns(memory)) {
+                ::operator delete(memory, bytes);
+                return;
+            }
+            // a block of nodes is split up in slots for single nodes
+            char* slot = static_cast<char*>(memory);
+            thread_cache* cache = cache_of_this_thread();
+            if (!cache) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (size_type offset = 0; offset + _slot_size <= bytes; offset += _slot_size) {
+                    _free = new(slot + offset) free_slot{_free};
+                }
+                return;
+            }
+            for (size_type offset = 0; offset + _slot_size <= bytes; offset += _slot_size) {
+                cache->free = new(slot + offset) free_slot{cache->free};
+                ++cache->free_count;
+            }
+            // a thread that only frees would otherwise keep all the slots to itself
+            if (cache->free_count > 2 * _slab_slots) {
+                hand_back(*cache, cache->free_count - _slab_slots);
+            }
+        }
+
+        [[nodiscard]]
+        bool owns(const void* memory) const noexcept {
+            auto* address = static_cast<const char*>(memory);
+            return _base && address >= _base && address < _base + _reserved;
+        }
+
+        // false when the system refused the huge pages (or the reservation), the arena then
+        // gives out normal pages
+        [[nodiscard]]
+        bool huge_pages() const noexcept {
+            return _huge_pages;
+        }
+
+        // the bytes of the reservation that were taken at least once: by the threads a slab at a time,
+        // and by the blocks of nodes
+        [[nodiscard]]
+        size_type used() const noexcept {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _used;
+        }
+
+        // the bytes of the slabs that the threads take the slots for single nodes from
+        [[nodiscard]]
+        size_type slab_bytes() const noexcept {
+            return _slab_slots * _slot_size;
+        }
+
+    private:
+
+        struct free_slot {
+            free_slot* next;
+        };
+
+        // the slots of one arena that one thread allocates from without locking
+        struct thread_cache {
+            // 0 for a cache that is not in use, arena ids start at 1
+            std::uint64_t arena_id = 0;
+            huge_page_arena* arena = nullptr;
+            // the part of the slab that wasn't handed out yet
+            char* next = nullptr;
+            char* end = nullptr;
+            free_slot* free = nullptr;
+            size_type free_count = 0;
+        };
+
+        // the caches of one thread, for the last few arenas it used
+        struct thread_caches {
+            static constexpr std::size_t ways = 4;
+            thread_cache entries[ways];
+            // the entry that is replaced next
+            std::size_t hand = 0;
+
+            ~thread_caches() noexcept {
+                for (auto& cache : entries) {
+                    release(cache);
+                }
+                caches_gone() = true;
+                last_cache() = nullptr;
+            }
+        };
+
+        size_type _slot_size;
+        size_type _slab_slots;
+        std::uint64_t _id;
+        char* _base;
+        size_type _reserved;
+        size_type _committed;
+        size_type _used;
+        bool _huge_pages;
+        free_slot* _free;
+        mutable std::mutex _mutex;
+
+        template<typename _U>
+        static constexpr _U round_up(_U value, size_type to) noexcept {
+            return (value + to - 1) / to * to;
+        }
+
+        static std::uint64_t next_id() noexcept {
+            static std::atomic<std::uint64_t> last{0};
+            return ++last;
+        }
+
+        // the arenas that exist, so a thread that ends only hands its caches back to a live arena.
+        // Never destroyed, threads may end after the statics are gone
+        static std::mutex& registry_mutex() {
+            static auto* mutex = new std::mutex();
+            return *mutex;
+        }
+
+        static std::vector<huge_page_arena*>& registry() {
+            static auto* arenas = new std::vector<huge_page_arena*>();
+            return *arenas;
+        }
+
+        // set once the caches of this thread are destroyed: a list with a static lifetime frees its nodes
+        // after that, and then takes the lock. Trivially destructible, so it can be read at any time
+        static bool& caches_gone() noexcept {
+            thread_local bool gone = false;
+            return gone;
+        }
+
+        // the cache the calling thread used last, the one that is nearly always asked for again. Reaching
+        // it doesn't go through the initialisation check of the thread_caches
+        static thread_cache*& last_cache() noexcept {
+            thread_local thread_cache* last = nullptr;
+            return last;
+        }
+
+        // the cache of this arena for the calling thread, nullptr once the thread's caches are destroyed
+        thread_cache* cache_of_this_thread() noexcept {
+            thread_cache* last = last_cache();
+            if (last && last->arena_id == _id) {
+                return last;
+            }
+            if (caches_gone()) {
+                return nullptr;
+            }
+            thread_local thread_caches caches;
+            thread_cache* found = nullptr;
+            for (auto& cache : caches.entries) {
+                if (cache.arena_id == _id) {
+                    found = &cache;
+                }
+            }
+            if (!found) {
+                found = &caches.entries[caches.hand++ % thread_caches::ways];
+                release(*found);
+                found->arena_id = _id;
+                found->arena = this;
+            }
+            last_cache() = found;
+            return found;
+        }
+
+        // hands the slots of cache back to its arena, when that still exists, and empties it
+        static void release(thread_cache& cache) noexcept {
+            if (cache.arena_id != 0) {
+                std::lock_guard<std::mutex> registry_lock(registry_mutex());
+                auto& live = registry();
+                if (std::find(live.begin(), live.end(), cache.arena) != live.end() &&
+                    cache.arena->_id == cache.arena_id) {
+                    huge_page_arena& arena = *cache.arena;
+                    std::lock_guard<std::mutex> lock(arena._mutex);
+                    for (char* slot = cache.next; slot != cache.end; slot += arena._slot_size) {
+                        arena._free = new(slot) free_slot{arena._free};
+                    }
+                    while (cache.free) {
+                        free_slot* slot = cache.free;
+                        cache.free = slot->next;
+                        slot->next = arena._free;
+                        arena._free = slot;
+                    }
+                }
+            }
+            cache = thread_cache{};
+        }
+
+        // gives the cache a batch of freed slots, or else a new slab; false when the reservation is used up
+        bool refill(thread_cache& cache) noexcept {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_free) {
+                for (size_type i = 0; i < _slab_slots && _free; ++i) {
+                    free_slot* slot = _free;
+                    _free = slot->next;
+                    slot->next = cache.free;
+                    cache.free = slot;
+                    ++cache.free_count;
+                }
+                return true;
+            }
+            size_type bytes = std::min(_slab_slots * _slot_size, (_reserved - _used) / _slot_size * _slot_size);
+            if (bytes == 0 || !commit(bytes)) {
+                return false;
+            }
+            cache.next = _base + _used;
+            cache.end = cache.next + bytes;
+            _used += bytes;
+            return true;
+        }
+
+        // moves the first count freed slots of cache to the arena
+        void hand_back(thread_cache& cache, size_type count) noexcept {
+            free_slot* first = cache.free;
+            free_slot* last = first;
+            for (size_type i = 1; i < count; ++i) {
+                last = last->next;
+            }
+            cache.free = last->next;
+            cache.free_count -= count;
+            std::lock_guard<std::mutex> lock(_mutex);
+            last->next = _free;
+            _free = first;
+        }
+
+        // makes sure the next bytes of the reservation can be written
+        bool commit(size_type bytes) noexcept {
+            if (!_base || _used + bytes > _reserved) {
+                return false;
+            }
+            if (_used + bytes <= _committed) {
+                return true;
+            }
+#if defined(__linux__)
+            size_type target = round_up(_used + bytes, commit_step);
+            if (target > _reserved) {
+                target = _reserved;
+            }
+            if (::mprotect(_base + _committed, target - _committed, PROT_READ | PROT_WRITE) != 0) {
+                return false;
+            }
+            _committed = target;
+            return true;
+#else
+            return false;
+#endif
+        }
+    };
+}
+
+#endif //INCLUDE_HUGE_PAGE_ARENA_H
@@ -0,0 +1,287 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef INCLUDE_LAZY_LIST_H
+#define INCLUDE_LAZY_LIST_H
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "forward_list.h"
+
+namespace saxion {
+
+    template<typename _T>
+    class lazy_list;
+
+    namespace detail {
+
+        // iterating reaches the end of the materialized nodes, then asks the list for the next one
+        template<typename _T, typename _Nd>
+        class lazy_list_iterator {
+        public:
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+            using pointer = const _T*;
+            using reference = const _T&;
+            using value_type = _T;
+
+        private:
+            template<typename> friend
+            class ::saxion::lazy_list;
+
+            using node_t = _Nd;
+
+            const lazy_list<_T>* _list;
+            // nullptr is the end
+            const node_t* _current;
+
+            lazy_list_iterator(const lazy_list<_T>* list, const node_t* node) noexcept:
+                    _list(list),
+                    _current(node) {}
+
+        public:
+            lazy_list_iterator() noexcept:
+                    _list(nullptr),
+                    _current(nullptr) {}
+
+            reference operator*() const {
+                return _current->value();
+            }
+
+            [[nodiscard]]
+            pointer operator->() const {
+                return std::addressof(_current->value());
+            }
+
+            lazy_list_iterator& operator++() {
+                if (!_current->next()) {
+                    _list->materialize_next();
+                }
+                _current = _current->next();
+                return *this;
+            }
+
+            lazy_list_iterator operator++(int) {
+                lazy_list_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+
+            [[nodiscard]]
+            bool operator==(const lazy_list_iterator& other) const {
+                return _current == other._current;
+            }
+
+            [[nodiscard]]
+            bool operator!=(const lazy_list_iterator& other) const {
+                return !(*this == other);
+            }
+        };
+    }
+
+    // a singly-linked list whose elements come from a generator: a callable that returns
+    // std::optional<_T> and returns std::nullopt once it has nothing more to give.
+    // A node is only made when iteration (or front, take, size) reaches it, and then it is kept,
+    // so a second iteration doesn't call the generator again. The time to the first element is
+    // independent of the length of the list, size() materializes everything.
+    // The elements are read-only: they are what the generator produced
+    template<typename _T>
+    class lazy_list {
+    public:
+        using value_type = _T;
+        using reference = _T const&;
+        using const_reference = _T const&;
+        using pointer = _T const*;
+        using const_pointer = _T const*;
+        using size_type = std::size_t;
+        using generator_type = std::function<std::optional<_T>()>;
+
+    private:
+
+        template<typename, typename> friend
+        class detail::lazy_list_iterator;
+
+        using node_t = detail::forward_list_node_t<_T>;
+
+        // materializing is not a visible change, so the const members may do it
+        mutable generator_type _generator;
+        mutable typename node_t::link_type _head;
+        mutable node_t* _tail;
+        mutable size_type _materialized;
+
+        // pulls one element from the generator, returns false once it is exhausted
+        bool materialize_next() const {
+            if (!_generator) {
+                return false;
+            }
+            std::optional<_T> value = _generator();
+            if (!value) {
+                // the generator may hold resources, let go of it as soon as it is done
+                _generator = nullptr;
+                return false;
+            }
+            typename node_t::link_type created(new node_t(std::move(*value), nullptr));
+            node_t* raw = created.get();
+            if (_tail) {
+                _tail->_next = std::move(created);
+            } else {
+                _head = std::move(created);
+            }
+            _tail = raw;
+            ++_materialized;
+            return true;
+        }
+
+        // materializes until there are at least n nodes (or the generator is exhausted)
+        void materialize(size_type n) const {
+            while (_materialized < n && materialize_next()) {
+            }
+        }
+
+    public:
+
+        using iterator = detail::lazy_list_iterator<_T, node_t>;
+        using const_iterator = iterator;
+
+        lazy_list() :
+                _generator{},
+                _head{nullptr},
+                _tail{nullptr},
+                _materialized{0} {
+        }
+
+        template<typename _Gen, typename = std::enable_if_t<
+                std::is_convertible_v<std::invoke_result_t<_Gen&>, std::optional<_T>>>>
+        explicit lazy_list(_Gen generator) :
+                lazy_list() {
+            _generator = std::move(generator);
+        }
+
+        // a generator can't be shared, so a lazy_list can only be moved
+        lazy_list(const lazy_list&) = delete;
+
+        lazy_list& operator=(const lazy_list&) = delete;
+
+        lazy_list(lazy_list&& other) noexcept :
+                lazy_list() {
+            swap(other);
+        }
+
+        lazy_list& operator=(lazy_list&& other) noexcept {
+            if (this != &other) {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~lazy_list() noexcept {
+            clear();
+        }
+
+        void swap(lazy_list& other) noexcept {
+            std::swap(_generator, other._generator);
+            std::swap(_head, other._head);
+            std::swap(_tail, other._tail);
+            std::swap(_materialized, other._materialized);
+        }
+
+        [[nodiscard]]
+        iterator begin() const {
+            materialize(1);
+            return iterator(this, _head.get());
+        }
+
+        [[nodiscard]]
+        iterator end() const noexcept {
+            return iterator(this, nullptr);
+        }
+
+        [[nodiscard]]
+        const_iterator cbegin() const {
+            return begin();
+        }
+
+        [[nodiscard]]
+        const_iterator cend() const noexcept {
+            return end();
+        }
+
+        // materializes at most the first element
+        [[nodiscard]]
+        const_reference front() const {
+            materialize(1);
+            if (!_head) {
+                throw std::length_error("front() of an empty lazy_list");
+            }
+            return _head->value();
+        }
+
+        [[nodiscard]]
+        bool empty() const {
+            materialize(1);
+            return !_head;
+        }
+
+        // materializes the whole list
+        [[nodiscard]]
+        size_type size() const {
+            materialize(static_cast<size_type>(-1));
+            return _materialized;
+        }
+
+        // the number of nodes made so far
+        [[nodiscard]]
+        size_type materialized() const noexcept {
+            return _materialized;
+        }
+
+        // true once the generator has returned std::nullopt
+        [[nodiscard]]
+        bool exhausted() const noexcept {
+            return !_generator;
+        }
+
+        // copies the first n elements (fewer if the list is shorter), materializing only those
+        [[nodiscard]]
+        forward_list<_T> take(size_type n) const {
+            materialize(n);
+            forward_list<_T> result;
+            for (const node_t* node = _head.get(); node && n; node = node->next(), --n) {
+                result.push_back(node->value());
+            }
+            return result;
+        }
+
+        // drops the elements and the generator
+        void clear() noexcept {
+            // unlink the nodes iteratively, a long chain of links would destroy itself recursively
+            while (_head) {
+                _head = std::move(_head->_next);
+            }
+            _tail = nullptr;
+            _materialized = 0;
+            _generator = nullptr;
+        }
+    };
+
+    template<typename _Gen>
+    lazy_list(_Gen) -> lazy_list<typename std::invoke_result_t<_Gen&>::value_type>;
+
+}
+
+namespace std {
+    template<typename _T>
+    inline void swap(saxion::lazy_list<_T>& x, saxion::lazy_list<_T>& y) noexcept {
+        x.swap(y);
+    }
+}
+
+#endif //INCLUDE_LAZY_LIST_H
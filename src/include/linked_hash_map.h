@@ -0,0 +1,460 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef INCLUDE_LINKED_HASH_MAP_H
+#define INCLUDE_LINKED_HASH_MAP_H
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "list.h"
+
+namespace saxion {
+
+    namespace detail {
+
+        // spreads the bits of a std::hash result, the identity hashes of the integral types
+        // would otherwise cluster badly in a power-of-two table with linear probing
+        inline std::size_t mix_hash(std::size_t hash) noexcept {
+            hash *= 0x9E3779B97F4A7C15ull;
+            return hash ^ (hash >> 32u);
+        }
+    }
+
+    // an insertion-ordered hash map
+    // every entry is a single list node that is linked in the doubly-linked order of the map and
+    // referenced from an open-addressing (linear probing) table. The table only holds the pointer to the node
+    // and its hash, so there is one allocation per entry and the order and the index can never drift apart.
+    // find, erase(key) and move_to_back are O(1), iteration follows the insertion order.
+    template<typename _K, typename _V, typename _Hash = std::hash<_K>, typename _Eq = std::equal_to<_K>>
+    class linked_hash_map {
+    public:
+        using key_type = _K;
+        using mapped_type = _V;
+        using value_type = std::pair<const _K, _V>;
+        using reference = value_type&;
+        using const_reference = value_type const&;
+        using pointer = value_type*;
+        using const_pointer = value_type const*;
+        using size_type = std::size_t;
+        using hasher = _Hash;
+        using key_equal = _Eq;
+
+    private:
+
+        // the nodes and iterators of the list are reused as they are
+        using node_t = detail::list_node_t<value_type>;
+        using link_type = typename node_t::link_type;
+
+        struct slot_t {
+            std::size_t hash;
+            node_t* node;
+        };
+
+        // the sentinel node of the insertion order, just like in the list
+        node_t _node;
+        size_type _size;
+        // the table, its capacity is always a power of two (or 0 before the first insertion)
+        std::unique_ptr<slot_t[]> _slots;
+        size_type _capacity;
+        hasher _hasher;
+        key_equal _equal;
+
+        [[nodiscard]]
+        node_t* head() const noexcept{
+            return _node.next();
+        }
+
+        [[nodiscard]]
+        node_t* tail() const noexcept{
+            return _node.prev();
+        }
+
+    public:
+
+        using iterator = detail::list_iterator<value_type, node_t>;
+        using const_iterator = detail::const_list_iterator<value_type, node_t>;
+
+        // default ctor
+        linked_hash_map() :
+                _node{},
+                _size{0},
+                _slots{nullptr},
+                _capacity{0},
+                _hasher{},
+                _equal{} {
+            //empty map has a self-referencing node!
+            _node._prev = &_node;
+            _node._next.reset(&_node);
+        }
+
+        linked_hash_map(std::initializer_list<value_type> init_list) :
+                linked_hash_map() {
+            for (auto& item : init_list) {
+                insert(item);
+            }
+        }
+
+        // copy ctor
+        linked_hash_map(const linked_hash_map& other) :
+                linked_hash_map() {
+            for (auto& item : other) {
+                insert(item);
+            }
+        }
+
+        // copy assignment operator
+        linked_hash_map& operator=(const linked_hash_map& other) {
+            if (this != &other) {
+                clear();
+                for (auto& item : other) {
+                    insert(item);
+                }
+            }
+            return *this;
+        }
+
+        // move ctor
+        linked_hash_map(linked_hash_map&& other) noexcept :
+                linked_hash_map() {
+            swap(other);
+        }
+
+        // move assignment operator
+        linked_hash_map& operator=(linked_hash_map&& other) noexcept {
+            if (this != &other) {
+                clear();
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~linked_hash_map() noexcept {
+            clear();
+        }
+
+        [[nodiscard]]
+        iterator begin() noexcept {
+            return iterator(head());
+        }
+
+        [[nodiscard]]
+        iterator end() noexcept {
+            return iterator(&_node);
+        }
+
+        [[nodiscard]]
+        const_iterator begin() const noexcept {
+            return const_iterator(head());
+        }
+
+        [[nodiscard]]
+        const_iterator end() const noexcept {
+            return const_iterator(&_node);
+        }
+
+        [[nodiscard]]
+        const_iterator cbegin() const noexcept {
+            return const_iterator(head());
+        }
+
+        [[nodiscard]]
+        const_iterator cend() const noexcept {
+            return const_iterator(&_node);
+        }
+
+        void swap(linked_hash_map& other) noexcept {
+            // the values of the sentinels are never used, so only their links are exchanged
+            std::swap(tail()->_next, other.tail()->_next);
+            std::swap(_node._next, other._node._next);
+            std::swap(_node._prev, other._node._prev);
+            relink_sentinel();
+            other.relink_sentinel();
+            std::swap(_size, other._size);
+            std::swap(_slots, other._slots);
+            std::swap(_capacity, other._capacity);
+            std::swap(_hasher, other._hasher);
+            std::swap(_equal, other._equal);
+        }
+
+        // accessors
+        [[nodiscard]]
+        reference front() {
+            return head()->value();
+        }
+
+        [[nodiscard]]
+        const_reference front() const {
+            return head()->value();
+        }
+
+        [[nodiscard]]
+        reference back() {
+            return tail()->value();
+        }
+
+        [[nodiscard]]
+        const_reference back() const {
+            return tail()->value();
+        }
+
+        [[nodiscard]]
+        bool empty() const {
+            return _size == 0;
+        }
+
+        [[nodiscard]]
+        size_type size() const {
+            return _size;
+        }
+
+        [[nodiscard]]
+        iterator find(const key_type& key) {
+            node_t* found = lookup(key);
+            return found ? iterator(found) : end();
+        }
+
+        [[nodiscard]]
+        const_iterator find(const key_type& key) const {
+            node_t* found = lookup(key);
+            return found ? const_iterator(found) : end();
+        }
+
+        [[nodiscard]]
+        bool contains(const key_type& key) const {
+            return lookup(key) != nullptr;
+        }
+
+        [[nodiscard]]
+        size_type count(const key_type& key) const {
+            return contains(key) ? 1 : 0;
+        }
+
+        [[nodiscard]]
+        mapped_type& at(const key_type& key) {
+            if (node_t* found = lookup(key)) {
+                return found->value().second;
+            }
+            throw std::out_of_range("key not found");
+        }
+
+        [[nodiscard]]
+        const mapped_type& at(const key_type& key) const {
+            if (node_t* found = lookup(key)) {
+                return found->value().second;
+            }
+            throw std::out_of_range("key not found");
+        }
+
+        // a missing key is inserted at the back with a default constructed value
+        mapped_type& operator[](const key_type& key) {
+            return try_emplace(key).first->second;
+        }
+
+        // modifiers
+
+        // inserts the value at the back, unless its key is already present
+        // returns an iterator to the element with that key and whether the insertion took place
+        std::pair<iterator, bool> insert(const value_type& value) {
+            return try_emplace(value.first, value.second);
+        }
+
+        std::pair<iterator, bool> insert(value_type&& value) {
+            return try_emplace(value.first, std::move(value.second));
+        }
+
+        template<typename... Args>
+        std::pair<iterator, bool> try_emplace(const key_type& key, Args&& ... args) {
+            grow_if_needed();
+            std::size_t hash = detail::mix_hash(_hasher(key));
+            size_type index = probe(key, hash);
+            if (_slots[index].node) {
+                return {iterator(_slots[index].node), false};
+            }
+            link_type created(new node_t(std::in_place, nullptr, std::piecewise_construct, std::forward_as_tuple(key),
+                                         std::forward_as_tuple(std::forward<Args>(args)...)));
+            _slots[index] = {hash, created.get()};
+            link_before(&_node, std::move(created));
+            ++_size;
+            return {iterator(tail()), true};
+        }
+
+        // removes the element with the given key, returns the number of removed elements
+        size_type erase(const key_type& key) {
+            if (!_size) {
+                return 0;
+            }
+            size_type index = probe(key, detail::mix_hash(_hasher(key)));
+            if (!_slots[index].node) {
+                return 0;
+            }
+            node_t* node = _slots[index].node;
+            remove_slot(index);
+            destroy(node);
+            return 1;
+        }
+
+        // removes the element pointed to by pos and returns an iterator to the element that followed it
+        iterator erase(iterator pos) {
+            node_t* next = pos.node()->next();
+            remove_slot(slot_of(pos.node()));
+            destroy(pos.node());
+            return iterator(next);
+        }
+
+        void pop_front() noexcept {
+            if (!empty()) {
+                erase(begin());
+            }
+        }
+
+        // relinks the element to the back of the order, the key stays where it is in the table
+        iterator move_to_back(iterator pos) {
+            node_t* node = pos.node();
+            if (node != tail()) {
+                link_before(&_node, unlink(node));
+            }
+            return pos;
+        }
+
+        iterator move_to_back(const key_type& key) {
+            node_t* found = lookup(key);
+            return found ? move_to_back(iterator(found)) : end();
+        }
+
+        void clear() noexcept {
+            if (!empty()) {
+                // unlink the nodes iteratively
+                while (head() != &_node) {
+                    _node._next = std::move(_node._next->_next);
+                }
+                _node._prev = &_node;
+                _size = 0;
+                std::fill(_slots.get(), _slots.get() + _capacity, slot_t{0, nullptr});
+            }
+        }
+
+    private:
+
+        [[nodiscard]]
+        size_type mask() const noexcept {
+            return _capacity - 1;
+        }
+
+        // returns the slot that holds key, or the empty slot where key would go
+        [[nodiscard]]
+        size_type probe(const key_type& key, std::size_t hash) const {
+            size_type index = hash & mask();
+            while (_slots[index].node) {
+                if (_slots[index].hash == hash && _equal(_slots[index].node->value().first, key)) {
+                    return index;
+                }
+                index = (index + 1) & mask();
+            }
+            return index;
+        }
+
+        [[nodiscard]]
+        node_t* lookup(const key_type& key) const {
+            if (!_size) {
+                return nullptr;
+            }
+            return _slots[probe(key, detail::mix_hash(_hasher(key)))].node;
+        }
+
+        // the slot of a node that is known to be in the map
+        [[nodiscard]]
+        size_type slot_of(const node_t* node) const {
+            return probe(node->value().first, detail::mix_hash(_hasher(node->value().first)));
+        }
+
+        // keeps the load factor at or below 3/4
+        void grow_if_needed() {
+            if ((_size + 1) * 4 <= _capacity * 3) {
+                return;
+            }
+            size_type capacity = _capacity ? _capacity * 2 : 8;
+            auto slots = std::make_unique<slot_t[]>(capacity);
+            for (size_type i = 0; i < capacity; ++i) {
+                slots[i] = {0, nullptr};
+            }
+            for (size_type i = 0; i < _capacity; ++i) {
+                if (_slots[i].node) {
+                    size_type index = _slots[i].hash & (capacity - 1);
+                    while (slots[index].node) {
+                        index = (index + 1) & (capacity - 1);
+                    }
+                    slots[index] = _slots[i];
+                }
+            }
+            _slots = std::move(slots);
+            _capacity = capacity;
+        }
+
+        // empties a slot with backward shift deletion, so the table never needs tombstones
+        void remove_slot(size_type index) noexcept {
+            size_type next = index;
+            while (true) {
+                next = (next + 1) & mask();
+                if (!_slots[next].node) {
+                    break;
+                }
+                size_type home = _slots[next].hash & mask();
+                // the entry at next may move into the hole unless its home lies cyclically in (index, next]
+                bool stays = index <= next ? (index < home && home <= next) : (index < home || home <= next);
+                if (!stays) {
+                    _slots[index] = _slots[next];
+                    index = next;
+                }
+            }
+            _slots[index] = {0, nullptr};
+        }
+
+        // takes the node out of the order and hands over its ownership
+        link_type unlink(node_t* node) noexcept {
+            node_t* prev = node->prev();
+            link_type owned = std::move(prev->_next);
+            prev->_next = std::move(owned->_next);
+            prev->next()->_prev = prev;
+            return owned;
+        }
+
+        void link_before(node_t* pos, link_type node) noexcept {
+            node_t* prev = pos->prev();
+            node->_prev = prev;
+            node->_next = std::move(prev->_next);
+            pos->_prev = node.get();
+            prev->_next = std::move(node);
+        }
+
+        void destroy(node_t* node) noexcept {
+            unlink(node);
+            --_size;
+        }
+
+        void relink_sentinel() noexcept {
+            if (_node.next() == &_node) {
+                _node._prev = &_node;
+            } else {
+                _node.next()->_prev = &_node;
+            }
+        }
+
+    };
+
+}
+
+namespace std{
+    template<typename _K, typename _V, typename _Hash, typename _Eq>
+    inline void swap(saxion::linked_hash_map<_K, _V, _Hash, _Eq>& x,
+                     saxion::linked_hash_map<_K, _V, _Hash, _Eq>& y) noexcept {
+        x.swap(y);
+    }
+}
+
+#endif //INCLUDE_LINKED_HASH_MAP_H
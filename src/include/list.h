@@ -5,14 +5,28 @@
 #include <iterator>
 #include <initializer_list>
 #include <memory>
+#include <stdexcept>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "size_policy.h"
+#include "node_pool.h"
+#include "reclaimer.h"
 
 
 namespace saxion {
 
     //forward declarations of classes
-    template<typename _T>
+    template<typename _T, typename _SizePolicy, typename _Nd>
     class list;
 
+    // see parallel.h
+    template<typename _T, typename _SizePolicy, typename _Nd, typename _Comp>
+    void parallel_sort(list<_T, _SizePolicy, _Nd>& lst, _Comp comp, std::size_t threads);
+
     namespace detail {
         template<typename _T, typename _Nd>
         struct list_iterator;
@@ -24,14 +38,38 @@ namespace saxion {
     // normally all the things that are not intended for public use are grouped in an internal namespace (often "detail")
     namespace detail {
 
-        template<typename _T>
+        // the node of the list. A custom node (see list_nodes.h) derives from it and passes itself as _Derived,
+        // so the links point to the derived node and the list and its iterators never have to cast
+        template<typename _T, typename _Derived = void>
         struct list_node_t {
-            template<typename T> friend
+            template<typename, typename, typename> friend
             class ::saxion::list;
 
+            // the type the links point to
+            using node_type = std::conditional_t<std::is_void_v<_Derived>, list_node_t, _Derived>;
+
+            // a node that lives in a block of a defragmented list (see list::defragment) can't be deleted
+            // on its own: its memory goes back with the block. The deleter of the links tells them apart
+            struct deleter {
+                void operator()(node_type* node) const noexcept {
+                    if (node->in_block()) {
+                        node->~node_type();
+                    } else {
+                        delete node;
+                    }
+                }
+            };
+
+            using link_type = std::unique_ptr<node_type, deleter>;
+
             _T _value;
-            list_node_t* _prev;
-            std::unique_ptr<list_node_t> _next;
+            node_type* _prev;
+            link_type _next;
+            // the order-maintenance label: labels strictly increase from the head to the tail of a list
+            // the labels are below 2^62, the highest bit marks a node that lives in a block
+            std::uint64_t _label;
+
+            static constexpr std::uint64_t in_block_bit = std::uint64_t{1} << 63u;
 
             // copying of nodes is not possible
             list_node_t(const list_node_t&) = delete;
@@ -55,24 +93,35 @@ namespace saxion {
             list_node_t():
                 _value(),
                 _prev(nullptr),
-                _next(nullptr){
+                _next(nullptr),
+                _label(0){
             }
 
-            list_node_t(_T&& v, list_node_t* prev) :
+            list_node_t(_T&& v, node_type* prev) :
                     list_node_t{std::move(v), prev, nullptr} {}
 
-            list_node_t(_T const& v, list_node_t* prev) :
+            list_node_t(_T const& v, node_type* prev) :
                     list_node_t{v, prev, nullptr} {}
 
-            list_node_t(_T&& v, list_node_t* prev, list_node_t* next) :
+            list_node_t(_T&& v, node_type* prev, node_type* next) :
                     _value{std::move(v)},
                     _prev{prev},
-                    _next{next} {}
+                    _next{next},
+                    _label{0} {}
 
-            list_node_t(_T const& v, list_node_t* prev, list_node_t* next) :
+            list_node_t(_T const& v, node_type* prev, node_type* next) :
                     _value{v},
                     _prev{prev},
-                    _next{next} {}
+                    _next{next},
+                    _label{0} {}
+
+            // the piecewise constructor: the value is constructed from args right inside the node
+            template<typename... Args>
+            list_node_t(std::in_place_t, node_type* prev, Args&& ... args) :
+                    _value(std::forward<Args>(args)...),
+                    _prev{prev},
+                    _next{nullptr},
+                    _label{0} {}
 
             void swap(list_node_t& other) noexcept {
                 std::swap(_prev, other._prev);
@@ -90,34 +139,87 @@ namespace saxion {
 
             // a helper function that returns a pointer to the next node
             [[nodiscard]]
-            list_node_t* next() const noexcept{
+            node_type* next() const noexcept{
                 return _next.get();
             }
 
             // a helper function that returns a pointer to the previous node
             [[nodiscard]]
-            list_node_t* prev() const noexcept{
+            node_type* prev() const noexcept{
                 return _prev;
             }
+
+            // the label without the block flag
+            [[nodiscard]]
+            std::uint64_t label() const noexcept {
+                return _label & ~in_block_bit;
+            }
+
+            void set_label(std::uint64_t label) noexcept {
+                _label = (_label & in_block_bit) | label;
+            }
+
+            [[nodiscard]]
+            bool in_block() const noexcept {
+                return _label & in_block_bit;
+            }
+
+            void set_in_block() noexcept {
+                _label |= in_block_bit;
+            }
+
+            // the link to a node that was built in a block
+            [[nodiscard]]
+            static link_type block_link(node_type* node) noexcept {
+                node->set_in_block();
+                return link_type(node);
+            }
+
+            // whether destroying a node does nothing but destroy its link: then a list whose nodes all
+            // live in blocks can drop them without visiting them. A node with members that have to be
+            // destroyed has to clear it
+            static constexpr bool trivial_payload = std::is_trivially_destructible_v<_T>;
+
+            // replaces the value of a node that is reused, see list::assign(). A node that keeps data
+            // derived from the value (list_nodes.h) computes it again
+            template<typename _V>
+            void assign(_V&& value) {
+                _value = std::forward<_V>(value);
+            }
+
+            // the lookup protocol of list::find: the key is turned into a probe once,
+            // and every node is asked whether it matches it. A plain node compares its value
+            template<typename _Key>
+            [[nodiscard]]
+            static const _Key& probe(const _Key& key) noexcept {
+                return key;
+            }
+
+            template<typename _Probe>
+            [[nodiscard]]
+            bool matches(const _Probe& probe) const {
+                return _value == probe;
+            }
         };
 
         // the list iterator implementation
         template<typename _T, typename _Nd = list_node_t<_T>>
         struct list_iterator {
             using difference_type = std::ptrdiff_t;
-            //todo: fix the iterator category - it's wrong
-            using iterator_category = std::forward_iterator_tag;
+            using iterator_category = std::bidirectional_iterator_tag;
             using pointer = _T*;
             using reference = _T&;
             using value_type = _T;
 
-            template<typename> friend
+            template<typename, typename, typename> friend
             class ::saxion::list;
 
             using node_t = _Nd;
 
             // a pointer to the current node of this iterator
             node_t* _current;
+            // set when the iterator comes from a reversed list: it then walks along the _prev links
+            bool _reversed;
 
             // a convenience function to access the node
             node_t* node() {
@@ -131,16 +233,19 @@ namespace saxion {
             // never to be used constrcutor!
             // it is only here so we can default initalize an invalid iterator
             list_iterator() noexcept:
-                _current(nullptr)
+                _current(nullptr),
+                _reversed(false)
             {}
 
             // constructor
-            explicit list_iterator(node_t* element) noexcept:
-                    _current(element) {}
+            explicit list_iterator(node_t* element, bool reversed = false) noexcept:
+                    _current(element),
+                    _reversed(reversed) {}
 
             // conversion from the constant iterator
             explicit list_iterator(const const_list_iterator<_T, _Nd>& iter) noexcept:
-                    _current(const_cast<node_t*>(iter._current)) {
+                    _current(const_cast<node_t*>(iter._current)),
+                    _reversed(iter._reversed) {
             }
 
             // dereferencing
@@ -150,12 +255,12 @@ namespace saxion {
 
             [[nodiscard]]
             pointer operator->() const {
-                return std::addressof(_current->value);
+                return std::addressof(_current->value());
             }
 
             // iterating
             list_iterator& operator++() {
-                _current = _current->_next.get();
+                _current = _reversed ? _current->_prev : _current->_next.get();
                 return *this;
             }
 
@@ -166,13 +271,13 @@ namespace saxion {
             }
 
             list_iterator& operator--() {
-                // todo: this operation needs to step back in the list
+                _current = _reversed ? _current->_next.get() : _current->_prev;
                 return *this;
             }
 
             list_iterator operator--(int) {
                 list_iterator tmp(*this);
-                // todo: this operation needs to step back in the list
+                --(*this);
                 return tmp;
             }
 
@@ -190,18 +295,18 @@ namespace saxion {
         template<typename _T, typename _Nd = list_node_t<_T>>
         struct const_list_iterator {
             using difference_type = std::ptrdiff_t;
-            //todo: fix the iterator category - it's wrong
-            using iterator_category = std::forward_iterator_tag;
+            using iterator_category = std::bidirectional_iterator_tag;
             using pointer = const _T*;
             using reference = const _T&;
             using value_type = _T;
 
-            template<typename> friend
+            template<typename, typename, typename> friend
             class ::saxion::list;
 
             using node_t = _Nd;
 
             const node_t* _current;
+            bool _reversed;
 
             const node_t* node() const {
                 return _current;
@@ -210,14 +315,18 @@ namespace saxion {
             // never to be used constrcutor!
             // it is only here so we can default initalize an invalid iterator
             const_list_iterator():
-                _current(nullptr)
+                _current(nullptr),
+                _reversed(false)
             {}
 
-            explicit const_list_iterator(const node_t* element) noexcept:
-                    _current(element) {}
+            explicit const_list_iterator(const node_t* element, bool reversed = false) noexcept:
+                    _current(element),
+                    _reversed(reversed) {}
 
-            explicit const_list_iterator(const list_iterator<_T, _Nd>& iter) noexcept:
-                    _current(iter._current) {
+            // implicit on purpose: a mutable iterator can always be used where a constant one is expected
+            const_list_iterator(const list_iterator<_T, _Nd>& iter) noexcept: // NOLINT
+                    _current(iter._current),
+                    _reversed(iter._reversed) {
             }
 
             reference operator*() const {
@@ -226,38 +335,38 @@ namespace saxion {
 
             [[nodiscard]]
             pointer operator->() const {
-                return std::addressof(_current->value);
+                return std::addressof(_current->value());
             }
 
             const_list_iterator& operator++() {
-                // todo: this operation needs to move forward in the list
+                _current = _reversed ? _current->_prev : _current->_next.get();
                 return *this;
             }
 
             const_list_iterator operator++(int) {
                 const_list_iterator tmp(*this);
-                // todo: this operation needs to move forward in the list
+                ++(*this);
                 return tmp;
             }
 
             const_list_iterator& operator--() {
-                // todo: this operation needs to step back in the list
+                _current = _reversed ? _current->_next.get() : _current->_prev;
                 return *this;
             }
 
             const_list_iterator operator--(int) {
-                // todo: this operation needs to step back in the list
-                // and return a correct iterator
-                return *this;
+                const_list_iterator tmp(*this);
+                --(*this);
+                return tmp;
             }
 
             [[nodiscard]]
-            bool operator==(const const_list_iterator& other) {
+            bool operator==(const const_list_iterator& other) const {
                 return _current == other._current;
             }
 
             [[nodiscard]]
-            bool operator!=(const const_list_iterator& other) {
+            bool operator!=(const const_list_iterator& other) const {
                 return !(*this == other);
             }
 
@@ -277,8 +386,198 @@ namespace saxion {
         }
     }
 
+    namespace detail {
+
+        // a contiguous snapshot of the elements of a list, see list::flat_view()
+        // small trivially copyable elements are copied, so a scan reads one array
+        template<typename _T, bool _Copies>
+        class flat_view {
+        public:
+            using value_type = _T;
+            using size_type = std::size_t;
+            using const_reference = _T const&;
+            using const_iterator = const _T*;
+
+            flat_view(const _T* data, size_type size) noexcept:
+                    _data(data),
+                    _size(size) {}
+
+            [[nodiscard]]
+            const_iterator begin() const noexcept {
+                return _data;
+            }
+
+            [[nodiscard]]
+            const_iterator end() const noexcept {
+                return _data + _size;
+            }
+
+            [[nodiscard]]
+            const _T* data() const noexcept {
+                return _data;
+            }
+
+            [[nodiscard]]
+            const_reference operator[](size_type index) const noexcept {
+                return _data[index];
+            }
+
+            [[nodiscard]]
+            size_type size() const noexcept {
+                return _size;
+            }
+
+            [[nodiscard]]
+            bool empty() const noexcept {
+                return _size == 0;
+            }
+
+        private:
+            const _T* _data;
+            size_type _size;
+        };
+
+        // the other elements are referenced through an array of pointers to their nodes' values
+        template<typename _T>
+        class flat_view<_T, false> {
+        public:
+            using value_type = _T;
+            using size_type = std::size_t;
+            using const_reference = _T const&;
+
+            class const_iterator {
+            public:
+                using difference_type = std::ptrdiff_t;
+                using iterator_category = std::random_access_iterator_tag;
+                using pointer = const _T*;
+                using reference = const _T&;
+                using value_type = _T;
+
+                const_iterator() noexcept:
+                        _current(nullptr) {}
+
+                explicit const_iterator(const _T* const* current) noexcept:
+                        _current(current) {}
+
+                reference operator*() const {
+                    return **_current;
+                }
+
+                [[nodiscard]]
+                pointer operator->() const {
+                    return *_current;
+                }
+
+                reference operator[](difference_type n) const {
+                    return *_current[n];
+                }
+
+                const_iterator& operator++() {
+                    ++_current;
+                    return *this;
+                }
+
+                const_iterator operator++(int) {
+                    const_iterator tmp(*this);
+                    ++_current;
+                    return tmp;
+                }
+
+                const_iterator& operator--() {
+                    --_current;
+                    return *this;
+                }
+
+                const_iterator operator--(int) {
+                    const_iterator tmp(*this);
+                    --_current;
+                    return tmp;
+                }
+
+                const_iterator& operator+=(difference_type n) {
+                    _current += n;
+                    return *this;
+                }
+
+                const_iterator& operator-=(difference_type n) {
+                    _current -= n;
+                    return *this;
+                }
+
+                [[nodiscard]]
+                const_iterator operator+(difference_type n) const {
+                    return const_iterator(_current + n);
+                }
+
+                [[nodiscard]]
+                const_iterator operator-(difference_type n) const {
+                    return const_iterator(_current - n);
+                }
+
+                [[nodiscard]]
+                difference_type operator-(const const_iterator& other) const {
+                    return _current - other._current;
+                }
+
+                [[nodiscard]]
+                bool operator==(const const_iterator& other) const {
+                    return _current == other._current;
+                }
+
+                [[nodiscard]]
+                bool operator!=(const const_iterator& other) const {
+                    return _current != other._current;
+                }
+
+                [[nodiscard]]
+                bool operator<(const const_iterator& other) const {
+                    return _current < other._current;
+                }
+
+            private:
+                const _T* const* _current;
+            };
+
+            flat_view(const _T* const* data, size_type size) noexcept:
+                    _data(data),
+                    _size(size) {}
+
+            [[nodiscard]]
+            const_iterator begin() const noexcept {
+                return const_iterator(_data);
+            }
+
+            [[nodiscard]]
+            const_iterator end() const noexcept {
+                return const_iterator(_data + _size);
+            }
+
+            [[nodiscard]]
+            const_reference operator[](size_type index) const noexcept {
+                return *_data[index];
+            }
+
+            [[nodiscard]]
+            size_type size() const noexcept {
+                return _size;
+            }
+
+            [[nodiscard]]
+            bool empty() const noexcept {
+                return _size == 0;
+            }
+
+        private:
+            const _T* const* _data;
+            size_type _size;
+        };
+    }
+
     // here begins the list implementation
-    template<typename _T>
+    // the size policy (eager_size or lazy_size, see size_policy.h) decides whether moving ranges
+    // of nodes between lists counts them or leaves the size to be counted by the next size()
+    // the node type can be replaced by one that carries extra data, for example the ones in list_nodes.h
+    template<typename _T, typename _SizePolicy = eager_size, typename _Nd = detail::list_node_t<_T>>
     class list {
     public:
         using value_type = _T;
@@ -291,13 +590,37 @@ namespace saxion {
     private:
 
         // for convenience: define a node type
-        using node_t = detail::list_node_t<_T>;
+        using node_t = _Nd;
+
+        template<typename _U, typename _P, typename _N, typename _Comp>
+        friend void parallel_sort(list<_U, _P, _N>& lst, _Comp comp, std::size_t threads);
 
         // the sentinel node
         node_t _node;
-        //size of the list
-        size_type _size;
+        //size of the list, kept by the size policy. mutable, because a lazy size is counted and cached by size()
+        mutable _SizePolicy _size;
         // notice that there is no _tail pointer - it is not needed in a doubly-linked list with a sentinel node
+        // set by reverse(): the logical order of the list is then the opposite of the physical order of the links
+        bool _reversed;
+        // cleared when nodes with foreign labels are spliced in, the next order query relabels the list
+        mutable bool _labelled;
+
+        // small trivially copyable values are copied into the flat view, the others are pointed to
+        static constexpr bool flat_copies = std::is_trivially_copyable_v<_T> && sizeof(_T) <= 64;
+        using flat_element = std::conditional_t<flat_copies, _T, const _T*>;
+
+        // the snapshot behind flat_view(), rebuilt after any modification
+        mutable std::vector<flat_element> _flat;
+        mutable bool _flat_valid;
+
+        // the free nodes kept by clear(clear_mode::retain)
+        detail::node_pool<node_t> _pool;
+        // the blocks that reserve(), defragment() and the bulk constructors build the nodes in
+        using block_t = detail::node_block<node_t>;
+        detail::node_arena<node_t> _arena;
+        // false once a node may not live in a block, cleared conservatively: erasing doesn't set it again
+        bool _in_blocks;
+        using link_type = typename node_t::link_type;
 
         [[nodiscard]]
         node_t* head() const noexcept{
@@ -307,8 +630,19 @@ namespace saxion {
 
         [[nodiscard]]
         node_t* tail() const noexcept{
-            // todo: this should return a pointer to the last element of the list. Use the sentinel node for this.
-            return nullptr;
+            // the sentinel node links back to the last element
+            return _node.prev();
+        }
+
+        // head() and tail() follow the links, these two follow the logical order of the list
+        [[nodiscard]]
+        node_t* first() const noexcept{
+            return _reversed ? tail() : head();
+        }
+
+        [[nodiscard]]
+        node_t* last() const noexcept{
+            return _reversed ? head() : tail();
         }
 
     public:
@@ -319,44 +653,55 @@ namespace saxion {
         // default ctor
         list() :
                 _node{},
-                _size{0} {
+                _size{},
+                _reversed{false},
+                _labelled{true},
+                _flat{},
+                _flat_valid{false},
+                _pool{},
+                _arena{},
+                _in_blocks{true} {
             //empty list has a self-referencing node!
             _node._prev = &_node;
             _node._next.reset(&_node);
         }
 
+        // the constructors that know the number of elements up front build all the nodes in one block,
+        // like defragment() does
         template<typename _V>
         list(std::initializer_list<_V> init_list) :
                 list() {
-            (void)init_list; // remove this one
-            // todo: initialize the content with that of init_list
+            append_block(init_list.begin(), init_list.size());
         }
 
         // copy ctor
         list(const list& other) :
                 list() {
-            (void)other; //remove this one
-            // todo: copy the other list's content
+            append_block(other.begin(), other.size());
         }
 
         // copy assignment operator
         list& operator=(const list& other) {
-            (void)other;    //remove this one!
-            // todo: implement the copy assignment operator
+            if (this != &other) {
+                clear();
+                append_block(other.begin(), other.size());
+            }
             return *this;
         }
 
         // move ctor
         list(list&& other) noexcept :
                 list() {
-            (void)other; //remove this one
-            // todo: implement the move ctor
+            // same trick as in the forward_list: take over the content by swapping with an empty list
+            swap(other);
         }
 
         // move assignment operator
         list& operator=(list&& other) noexcept {
-            (void)other;    //remove this one
-            // todo: implement the move ctor
+            if (this != &other) {
+                clear();
+                swap(other);
+            }
             return *this;
         }
 
@@ -366,198 +711,1363 @@ namespace saxion {
                         value_type >>>
         list(_Iter begin, _Iter end):
                 list() {
-            (void)begin;    //remove this one
-            (void)end;      //remove this one
-            // todo: implement the constructor that takes two iterators
+            // the length of a single-pass range is only known at its end
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                    typename std::iterator_traits<_Iter>::iterator_category>) {
+                append_block(begin, static_cast<size_type>(std::distance(begin, end)));
+            } else {
+                for (; begin != end; ++begin) {
+                    push_back(*begin);
+                }
+            }
         }
 
+        // like every member that hands out a mutable element, begin() drops a flat view that holds copies
         [[nodiscard]]
         iterator begin() noexcept {
-            // todo: return the iterator to head
-            return iterator();
+            touch_values();
+            return iterator(first(), _reversed);
         }
 
         [[nodiscard]]
         iterator end() noexcept {
-            // todo: return the iterator to past-the-list element
-            return iterator();
+            return iterator(&_node, _reversed);
         }
 
         [[nodiscard]]
         const_iterator begin() const noexcept {
-            // todo: return the iterator to head
-            return const_iterator();
+            return const_iterator(first(), _reversed);
         }
 
         [[nodiscard]]
         const_iterator end() const noexcept {
-            // todo: return the iterator to past-the-list element
-            return const_iterator();
+            return const_iterator(&_node, _reversed);
         }
 
         [[nodiscard]]
         const_iterator cbegin() const noexcept {
-            // todo: return the iterator to head
-            return const_iterator();
+            return const_iterator(first(), _reversed);
         }
 
         [[nodiscard]]
         const_iterator cend() const noexcept {
-            // todo: return the iterator to past-the-list element
-            return const_iterator();
+            return const_iterator(&_node, _reversed);
         }
 
 
         void swap(list& other) noexcept {
-            (void)other;    //remove this one!
-            // todo: ! add swapping of the pointers and nodes
+            // the last node of each list owns the sentinel of that list; after swapping the
+            // sentinels' links, the neighbours have to be pointed at their new sentinel
+            std::swap(tail()->_next, other.tail()->_next);
+            _node.swap(other._node);
+            relink_sentinel();
+            other.relink_sentinel();
             std::swap(_size, other._size);
+            std::swap(_reversed, other._reversed);
+            std::swap(_labelled, other._labelled);
+            _pool.swap(other._pool);
+            _arena.swap(other._arena);
+            std::swap(_in_blocks, other._in_blocks);
+            touch();
+            other.touch();
         }
 
-        // todo: remove this if no longer needed - it is only used as return value
-        // for not implemented functions
-        value_type dummy_value = value_type();
-
         // accessors
         [[nodiscard]]
         reference front() {
-            // todo: return the first value in the list
-            return dummy_value;
+            touch_values();
+            return first()->value();
         }
 
         [[nodiscard]]
         const_reference front() const {
-            // todo: return the first value in the list
-            return dummy_value;
+            return first()->value();
         }
 
         [[nodiscard]]
         reference back() {
-            // todo: return the last value in the list
-            return dummy_value;
+            touch_values();
+            return last()->value();
         }
 
         [[nodiscard]]
         const_reference back() const {
-            // todo: return the last value in the list
-            return dummy_value;
+            return last()->value();
         }
 
         [[nodiscard]]
         reference operator[](size_type index) {
-            (void)index;    //remove this one!
-            // todo: return the value at index
-            return dummy_value;
+            touch_values();
+            return node_at(index)->value();
         }
 
         [[nodiscard]]
         const_reference operator[](size_type index) const {
-            (void)index;    //remove this one!
-            // todo: return the value at index
-            return dummy_value;
+            return node_at(index)->value();
         }
 
         [[nodiscard]]
         reference at(size_type index) {
-            (void)index;    //remove this one!
-            // todo: return the value at index or throw
-            return dummy_value;
+            if (index < size()) {
+                touch_values();
+                return node_at(index)->value();
+            }
+            throw std::length_error("index out of bounds");
         }
 
         [[nodiscard]]
         const_reference at( size_type index) const {
-            (void)index;    //remove this one!
-            // todo: return the value at index or throw
-            return dummy_value;
+            if (index < size()) {
+                return node_at(index)->value();
+            }
+            throw std::length_error("index out of bounds");
         }
 
         void pop_front() noexcept {
-            // todo: remove the first element from the list
+            if (!empty()) {
+                erase(begin());
+            }
         }
 
         void pop_back() noexcept {
-            // todo: remove the last element from the list
+            if (!empty()) {
+                erase(iterator(last(), _reversed));
+            }
         }
 
         [[nodiscard]]
         bool empty() const {
-            // todo: return something that makes sense
-            return true;
+            return head() == &_node;
+        }
+
+        // returns the first element that matches key, or end(). What matches is decided by the node type:
+        // a plain node compares the values, the nodes in list_nodes.h compare a cached hash or key first
+        template<typename _Key>
+        [[nodiscard]]
+        iterator find(const _Key& key) {
+            touch_values();
+            return iterator(const_cast<node_t*>(find_node(key)), _reversed);
+        }
+
+        template<typename _Key>
+        [[nodiscard]]
+        const_iterator find(const _Key& key) const {
+            return const_iterator(find_node(key), _reversed);
         }
 
+        // O(1), except for a lazy size after a splice: then the nodes are counted once
         [[nodiscard]]
         size_type size() const {
-            return _size;
+            if (!_size.known()) {
+                _size.assign(count(head(), &_node));
+            }
+            return _size.value();
         }
 
-        void clear() noexcept {
-           // todo: remove all the elemenets from the list
+        // clear_mode::retain destroys the values but keeps the nodes, so filling the list up to
+        // the same size again doesn't allocate
+        // when all the nodes live in blocks and destroying them does nothing (a trivially destructible
+        // element type, see node_t::trivial_payload), the nodes are not visited: the chain is dropped
+        // as a whole and the blocks are let go of, or reused for clear_mode::retain
+        void clear(clear_mode mode = clear_mode::release) noexcept {
+            if constexpr (node_t::trivial_payload) {
+                if (_in_blocks && !empty()) {
+                    _node._next.release();
+                    _node._next.reset(&_node);
+                    _node._prev = &_node;
+                }
+            }
+            if (!empty()) {
+                // unlink the nodes iteratively, a recursive destruction of the chain could overflow the stack
+                while (head() != &_node) {
+                    if (mode == clear_mode::retain && !head()->in_block()) {
+                        node_t* node = _node._next.release();
+                        _node._next = std::move(node->_next);
+                        _pool.recycle(node);
+                    } else {
+                        _node._next = std::move(_node._next->_next);
+                    }
+                }
+                _node._prev = &_node;
+            }
+            // the nodes of the blocks are gone, unless they were spliced into another list
+            _arena.release(mode == clear_mode::retain);
+            _in_blocks = true;
+            _size.assign(0);
+            _reversed = false;
+            _labelled = true;
+            touch();
         }
 
         ~list() noexcept {
-          // todo: implement the removal of all the nodes (is it really needed?)
+            clear();
+        }
+
+        // the nodes that clear(clear_mode::retain) and reserve() keep for the next insertions
+        [[nodiscard]]
+        size_type capacity() const {
+            return size() + _pool.size() + _arena.available();
+        }
+
+        // makes sure that the list can hold n elements without allocating
+        // the missing nodes are set aside in one block, the unused ones of an earlier reserve() included
+        void reserve(size_type n) {
+            size_type current = capacity();
+            if (n > current) {
+                _arena.reserve(n - current + _arena.available());
+            }
+        }
+
+        // frees the nodes kept by clear(clear_mode::retain) and reserve()
+        // a block of reserved nodes stays until its nodes are erased and the list is cleared
+        void shrink_to_fit() noexcept {
+            _pool.release();
+            if (empty()) {
+                _arena.release();
+            }
+            _arena.forget_spare();
         }
 
         // modifiers
         iterator push_back(_T&& value) {
-            (void)value;    //remove this one!
-            // todo: implement adding an element to the end of the list
-            return iterator(tail());
+            return insert(end(), std::move(value));
         }
 
         iterator push_back(const_reference value) {
-            (void)value;    //remove this one!
-            // todo: implement adding an element to the end of the list
-            return iterator(tail());
+            return insert(end(), value);
         }
 
         template<typename... Args>
-        iterator emplace_back([[maybe_unused]]Args&& ... args) {
-            // todo: ! implement constructing a node in-place at the end
-            return iterator(tail());
+        iterator emplace_back(Args&& ... args) {
+            return emplace(end(), std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        iterator emplace_front(Args&& ... args) {
+            return emplace(begin(), std::forward<Args>(args)...);
         }
 
         template<typename V>
         iterator push_front(V&& value) {
-            (void)value;    //remove this one!
-            // todo: implement adding an element at the front of the list
-            // notice that this function template takes a forwarding reference
-            return iterator(head());
+            return insert(begin(), std::forward<V>(value));
         }
 
+        // removes the element pointed to by pos and returns an iterator to the element that followed it
         iterator erase(iterator pos) {
-            (void)pos;    //remove this one!
-            // todo: !! implement a function that removes an element pointed to by pos iterator
-            // this function should return an iterator to the next element after the one that was removed
-            return iterator();
+            node_t* prev = pos.node()->prev();
+            node_t* next = pos.node()->next();
+            next->_prev = prev;
+            // the previous node owns pos, taking over its _next destroys the erased node
+            prev->_next = std::move(pos.node()->_next);
+            _size.subtract(1);
+            touch();
+            return iterator(_reversed ? prev : next, _reversed);
         }
 
         // insert element before pos
         // returns iterator to inserted element
         iterator insert(iterator pos, const_reference value) {
-            (void)pos;    //remove this one!
-            (void)value;    //remove this one!
-            // todo: !! implement inserting an element begore the element pointed to by pos iterator
-            // this function returns an iterator to the inserted element
-            return iterator();
+            return link_before(position(pos), make_node(value, nullptr));
         }
 
         // r-value reference overload
         iterator insert(iterator pos, _T&& value) {
-            (void)pos;    //remove this one!
-            (void)value;    //remove this one!
-            // todo: !! implement inserting an element before the element pointed to by pos iterator
-            // this function returns an iterator to the inserted element
-            return iterator();
+            return link_before(position(pos), make_node(std::move(value), nullptr));
         }
 
+        // emplace constructs the value from args in a new node before pos: the value is constructed
+        // once, in its final place, so even a type that can't be copied or moved can be stored
         template<typename... Args>
-        iterator emplace(iterator pos, [[maybe_unused]] Args&& ... args) {
-            (void)pos;    //remove this one!
-            // todo: !! implement emplacing an element before the element pointed to by pos iterator
-            // this function returns an iterator to the inserted element
-            // this function constructs element in-place
-            return iterator();
+        iterator emplace(iterator pos, Args&& ... args) {
+            return link_before(position(pos), make_node(std::in_place, nullptr, std::forward<Args>(args)...));
+        }
+
+        // inserts copies of [first, last) before pos and returns an iterator to the first of them, or pos
+        // when the range is empty. The nodes are made first and then linked in one go: a throwing copy
+        // leaves the list as it was, and the size, the labels and the flat view are updated once
+        template<typename _Iter, typename = typename std::iterator_traits<_Iter>::iterator_category>
+        iterator insert(iterator pos, _Iter first, _Iter last) {
+            chain created = make_chain(first, last);
+            if (!created.head) {
+                return pos;
+            }
+            return link_chain(position(pos), created);
+        }
+
+        iterator insert(iterator pos, std::initializer_list<_T> values) {
+            return insert(pos, values.begin(), values.end());
+        }
+
+        // appends the elements of anything that std::begin and std::end work on
+        template<typename _Range>
+        void append_range(_Range&& range) {
+            insert(end(), std::begin(range), std::end(range));
+        }
+
+        // replaces the elements by copies of [first, last). The values of the existing nodes are
+        // assigned to, only the difference in length is allocated or freed
+        template<typename _Iter, typename = typename std::iterator_traits<_Iter>::iterator_category>
+        void assign(_Iter first, _Iter last) {
+            iterator current = begin();
+            for (; current != end() && first != last; ++current, ++first) {
+                current.node()->assign(*first);
+            }
+            if (first == last) {
+                erase(current, end());
+            } else {
+                insert(end(), first, last);
+            }
+        }
+
+        void assign(std::initializer_list<_T> values) {
+            assign(values.begin(), values.end());
+        }
+
+        // removes the elements [first, last) and returns last. The range is unlinked in one go,
+        // after which its nodes are destroyed one after the other
+        iterator erase(iterator first, iterator last) {
+            if (first == last) {
+                return last;
+            }
+            // the physical range of nodes [from, to)
+            node_t* from = _reversed ? last.node()->next() : first.node();
+            node_t* to = _reversed ? first.node()->next() : last.node();
+            node_t* before = from->prev();
+            link_type range = std::move(before->_next);
+            before->_next = std::move(to->prev()->_next);
+            to->_prev = before;
+            size_type removed = 0;
+            while (range) {
+                range = std::move(range->_next);
+                ++removed;
+            }
+            _size.subtract(removed);
+            touch();
+            return last;
+        }
+
+        // removes the first n elements, or all of them when there are fewer
+        void pop_front_n(size_type n) {
+            iterator last = begin();
+            for (; n && last != end(); --n) {
+                ++last;
+            }
+            erase(begin(), last);
+        }
+
+        // removes the last n elements, or all of them when there are fewer
+        void pop_back_n(size_type n) {
+            iterator first = end();
+            for (; n && first != begin(); --n) {
+                --first;
+            }
+            erase(first, end());
+        }
+
+        // frees at most budget elements from the front, for a caller that spreads the teardown of a huge
+        // list over several calls. Returns true once the list is empty
+        bool clear_incremental(size_type budget) {
+            if constexpr (node_t::trivial_payload) {
+                if (_in_blocks) {
+                    clear();
+                    return true;
+                }
+            }
+            pop_front_n(budget);
+            if (empty()) {
+                clear();
+                return true;
+            }
+            return false;
+        }
+
+        // leaves the list empty in O(1) and hands the detached nodes to the background reclaimer
+        // (see reclaimer.h), the values are destroyed on that thread. The retained nodes stay with
+        // the list, the reserved ones go with the detached nodes
+        void detach_and_reclaim() {
+            if (empty()) {
+                return;
+            }
+            if constexpr (node_t::trivial_payload) {
+                if (_in_blocks) {
+                    clear();
+                    return;
+                }
+            }
+            auto detached = std::make_unique<reclaimer::holder<list>>();
+            detached->value.swap(*this);
+            _pool.swap(detached->value._pool);
+            reclaimer::instance().post(std::move(detached));
+        }
+
+        // reverses the list in O(1): only the direction in which the links are read is flipped
+        // iterators obtained before the call keep walking in the old direction
+        void reverse() noexcept {
+            _reversed = !_reversed;
+            touch();
+        }
+
+        [[nodiscard]]
+        bool reversed() const noexcept {
+            return _reversed;
+        }
+
+        // makes the physical order of the links match the logical order again, O(n)
+        // for code that walks the nodes itself
+        void normalize() noexcept {
+            if (!_reversed) {
+                return;
+            }
+            _reversed = false;
+            if (empty()) {
+                return;
+            }
+            // swap the roles of _prev and _next in every node, the sentinel included. Each node is visited
+            // after the node that owned it has let go of it, so a node is never owned twice when reset
+            node_t* current = &_node;
+            do {
+                node_t* next = current->_next.release();
+                current->_next.reset(current->_prev);
+                current->_prev = next;
+                current = next;
+            } while (current != &_node);
+            // the labels decrease along the new links, give out fresh ones
+            relabel_all();
+        }
+
+        // moves all the elements of other in front of pos, O(1) unless one of the lists is reversed
+        void splice(iterator pos, list& other) {
+            if (&other == this || other.empty()) {
+                return;
+            }
+            normalize();
+            other.normalize();
+            if (other._size.known()) {
+                _size.add(other._size.value());
+            } else {
+                _size.invalidate();
+            }
+            other._size.assign(0);
+            relink_range(pos.node(), other, other.head(), &other._node);
+        }
+
+        // moves the element at it in front of pos, O(1) unless one of the lists is reversed
+        void splice(iterator pos, list& other, iterator it) {
+            node_t* first_node = it.node();
+            node_t* last_node = std::next(it).node();
+            if (pos.node() == first_node || pos.node() == last_node) {
+                return;
+            }
+            normalize();
+            other.normalize();
+            if (&other != this) {
+                other._size.subtract(1);
+                _size.add(1);
+            }
+            relink_range(pos.node(), other, first_node, last_node);
+        }
+
+        // moves the elements [first, last) of other in front of pos, other may be this list
+        // the nodes are relinked, not copied. O(1) with a lazy size policy; an eager size policy
+        // has to count the moved elements. Spliced nodes are relabelled by the next order query
+        void splice(iterator pos, list& other, iterator first, iterator last) {
+            if (first == last) {
+                return;
+            }
+            node_t* first_node = first.node();
+            node_t* last_node = last.node();
+            // the links are spliced as they are, so both lists have to use them in the same direction
+            normalize();
+            other.normalize();
+            if (&other != this) {
+                if constexpr (_SizePolicy::counts_ranges) {
+                    size_type moved = count(first_node, last_node);
+                    other._size.subtract(moved);
+                    _size.add(moved);
+                } else {
+                    other._size.invalidate();
+                    _size.invalidate();
+                }
+            }
+            relink_range(pos.node(), other, first_node, last_node);
+        }
+
+        // merges the sorted list other into this sorted list, other ends up empty. Stable: of equal
+        // elements, the ones of this list come first. Only the links change, no value is moved and
+        // nothing is allocated. O(n) comparisons, plus O(n) when one of the lists is reversed
+        // when comp throws, all the elements are in this list, in an unspecified order
+        template<typename _Comp>
+        void merge(list& other, _Comp comp) {
+            if (&other == this || other.empty()) {
+                return;
+            }
+            normalize();
+            other.normalize();
+            touch();
+            other.touch();
+            _labelled = false;
+            _arena.share(other._arena);
+            _in_blocks = _in_blocks && other._in_blocks;
+            if (other._size.known()) {
+                _size.add(other._size.value());
+            } else {
+                _size.invalidate();
+            }
+            other._size.assign(0);
+            node_t* merged = take_chain();
+            node_t* theirs = other.take_chain();
+            other.adopt_chain(nullptr);
+            try {
+                merge_chains(merged, theirs, comp);
+            } catch (...) {
+                adopt_chain(merged);
+                throw;
+            }
+            adopt_chain(merged);
+        }
+
+        void merge(list& other) {
+            merge(other, std::less<>());
+        }
+
+        template<typename _Comp>
+        void merge(list&& other, _Comp comp) {
+            merge(other, comp);
+        }
+
+        void merge(list&& other) {
+            merge(other, std::less<>());
+        }
+
+        // a stable bottom-up merge sort that only relinks the nodes: no value is moved or copied and
+        // nothing is allocated, iterators stay valid. O(n log n) comparisons
+        // when comp throws, all the elements are still in the list, in an unspecified order
+        template<typename _Comp>
+        void sort(_Comp comp) {
+            normalize();
+            if (head() == tail()) {
+                return;
+            }
+            touch();
+            _labelled = false;
+            node_t* chain = take_chain();
+            try {
+                sort_chain(chain, comp);
+            } catch (...) {
+                adopt_chain(chain);
+                throw;
+            }
+            adopt_chain(chain);
+        }
+
+        void sort() {
+            sort(std::less<>());
+        }
+
+        // removes the elements for which pred is true and returns how many. One pass that relinks the
+        // kept nodes; the removed ones are freed together at the end, so value may refer to an element
+        // of the list. When pred throws, the elements it had already picked are removed
+        template<typename _Pred>
+        size_type remove_if(_Pred pred) {
+            return drop_nodes([&pred](const node_t*, node_t* node) { return pred(node->value()); });
+        }
+
+        template<typename _V>
+        size_type remove(const _V& value) {
+            return remove_if([&value](const _T& element) { return element == value; });
+        }
+
+        // removes every element that pred finds equal to the element kept before it, of a run of
+        // equal elements only the first one stays. Returns the number of removed elements
+        template<typename _BinaryPred>
+        size_type unique(_BinaryPred pred) {
+            return drop_nodes([&pred](const node_t* kept, node_t* node) {
+                return kept && pred(kept->value(), node->value());
+            });
+        }
+
+        size_type unique() {
+            return unique(std::equal_to<>());
+        }
+
+        // moves the elements for which pred is true in front of the others and returns the first of the
+        // others. One pass that relinks the nodes into two chains, the order within each group stays
+        // when pred throws, the elements it had already picked come first
+        template<typename _Pred>
+        iterator stable_partition(_Pred pred) {
+            normalize();
+            touch();
+            _labelled = false;
+            node_t* input = take_chain();
+            node_t* picked = nullptr;
+            node_t* picked_tail = nullptr;
+            node_t* others = nullptr;
+            node_t* others_tail = nullptr;
+            auto append = [](node_t*& chain, node_t*& chain_tail, node_t* node) {
+                if (chain_tail) {
+                    set_next(chain_tail, node);
+                } else {
+                    chain = node;
+                }
+                chain_tail = node;
+            };
+            try {
+                while (input) {
+                    node_t* node = input;
+                    bool first_group = pred(std::as_const(node->value()));
+                    input = node->next();
+                    set_next(node, nullptr);
+                    if (first_group) {
+                        append(picked, picked_tail, node);
+                    } else {
+                        append(others, others_tail, node);
+                    }
+                }
+            } catch (...) {
+                adopt_chain(concat(picked, concat(input, others)));
+                throw;
+            }
+            adopt_chain(concat(picked, others));
+            return iterator(others ? others : &_node, false);
+        }
+
+        // the same as stable_partition(), relinking keeps the order anyway
+        template<typename _Pred>
+        iterator partition(_Pred pred) {
+            return stable_partition(std::move(pred));
+        }
+
+        // moves the elements [pos, end()) into a new list, which is returned
+        // O(1) with a lazy size policy, an eager one counts the moved elements
+        list split_at(iterator pos) {
+            list result;
+            if (pos.node() == &_node) {
+                return result;
+            }
+            normalize();
+            touch();
+            result._arena.share(_arena);
+            result._in_blocks = _in_blocks;
+            // the moved nodes keep their labels, which are only in order when they were in this list
+            result._labelled = _labelled;
+            if constexpr (_SizePolicy::counts_ranges) {
+                size_type moved = count(pos.node(), &_node);
+                _size.subtract(moved);
+                result._size.assign(moved);
+            } else {
+                _size.invalidate();
+                result._size.invalidate();
+            }
+            node_t* first_node = pos.node();
+            node_t* last_node = tail();
+            node_t* before = first_node->prev();
+            auto range = std::move(before->_next);
+            // the last node of this list now owns the sentinel again
+            before->_next = std::move(last_node->_next);
+            _node._prev = before;
+            last_node->_next = std::move(result._node._next);
+            result._node._prev = last_node;
+            first_node->_prev = &result._node;
+            result._node._next = std::move(range);
+            return result;
+        }
+
+        // cuts the list in k ranges [first, last) of about equal length, in list order, for work on the
+        // elements that is spread over threads (see parallel.h). One pass that only follows the links,
+        // no value is read. The lengths differ by at most one; with fewer than k elements, some ranges
+        // are empty. The ranges are valid until the list is modified
+        [[nodiscard]]
+        std::vector<std::pair<iterator, iterator>> partition_points(size_type k) {
+            return cut(begin(), end(), k);
+        }
+
+        [[nodiscard]]
+        std::vector<std::pair<const_iterator, const_iterator>> partition_points(size_type k) const {
+            return cut(begin(), end(), k);
+        }
+
+        // moves the nodes into one contiguous block in list order, so a traversal reads memory
+        // sequentially again after the nodes got scattered over the heap by insertions and erasures.
+        // The values are moved, their old nodes destroyed. For every element, remap(from, to) is called
+        // with its old position (only to be compared with) and its new one, before the old node is gone;
+        // that is how the holders of iterators or pointers can update them. O(n)
+        void defragment() {
+            defragment([](const_iterator, iterator) {});
+        }
+
+        template<typename _Remap>
+        void defragment(_Remap remap) {
+            // the block is filled in list order, so the links have to run in list order too
+            normalize();
+            touch();
+            size_type n = size();
+            if (n == 0) {
+                return;
+            }
+            auto block = std::make_shared<block_t>(n);
+            node_t* old_tail = tail();
+            node_t* current = head();
+            size_type built = 0;
+            try {
+                for (; built < n; ++built, current = current->next()) {
+                    node_t* node = block->construct(built, std::move(current->value()), nullptr);
+                    node->set_in_block();
+                    node->set_label(current->label());
+                    node->_prev = built == 0 ? &_node : block->at(built - 1);
+                    remap(const_iterator(current), iterator(node));
+                }
+            } catch (...) {
+                // the nodes built so far are destroyed, the values that were moved out stay moved out
+                block->destroy(built);
+                throw;
+            }
+            // link the new nodes: every node owns the next one, the last one owns the sentinel
+            for (size_type i = 0; i + 1 < n; ++i) {
+                block->at(i)->_next = link_type(block->at(i + 1));
+            }
+            link_type old = std::move(_node._next);
+            block->at(n - 1)->_next = std::move(old_tail->_next);
+            _node._next = link_type(block->at(0));
+            _node._prev = block->at(n - 1);
+            // the old chain now ends in an empty link, destroy it iteratively
+            while (old) {
+                old = std::move(old->_next);
+            }
+            // the old blocks are empty now, unless a part of them was spliced into another list
+            _arena.release();
+            _arena.adopt(std::move(block));
+            _in_blocks = true;
+        }
+
+        // the same as defragment()
+        void compact() {
+            defragment();
+        }
+
+        template<typename _Remap>
+        void compact(_Remap remap) {
+            defragment(std::move(remap));
+        }
+
+        using flat_view_type = detail::flat_view<_T, flat_copies>;
+
+        // a contiguous snapshot of the list in list order, for lists that are scanned far more often than
+        // they are changed. It is built by the first call, O(n), and then returned in O(1) until the list
+        // is modified. The view itself is invalidated by that modification as well.
+        // Elements of small trivially copyable types are copied, so a loop over the view reads one array
+        // and can be vectorized; other elements are reached through an array of pointers, which still
+        // replaces the dependent loads of a list traversal by independent ones.
+        // Members that hand out mutable elements (front, back, begin, [], at, find) drop copies as well:
+        // the list can't see a write through the reference they return. That includes the non-const
+        // begin() of a range-for, so take the view of a list that is only read, or through a const
+        // reference. A dropped view is rebuilt in the same storage, so a view that was taken before it
+        // then shows the new snapshot, or dangles when the storage had to grow.
+        // Building the view writes to the list although this member is const, so it is not safe to call
+        // from several threads at once; once a view has been built after the last modification (or
+        // mutable access), the next calls only read and may run at the same time
+        [[nodiscard]]
+        flat_view_type flat_view() const {
+            if (!_flat_valid) {
+                _flat.clear();
+                _flat.reserve(size());
+                for (const node_t* node = first(); node != &_node; node = _reversed ? node->prev() : node->next()) {
+                    if constexpr (flat_copies) {
+                        _flat.push_back(node->value());
+                    } else {
+                        _flat.push_back(std::addressof(node->value()));
+                    }
+                }
+                _flat_valid = true;
+            }
+            return flat_view_type(_flat.data(), _flat.size());
+        }
+
+        // order queries
+        // every node carries a label and the labels increase along the list, so comparing the positions
+        // of two elements is a comparison of two integers instead of a walk through the list.
+        // the end() iterator comes after every element
+        // the labels are renewed lazily: the first query after a splice (or another change that leaves
+        // labels out of order) relabels the whole list, which writes to every node although the queries
+        // are const. So they are not safe to call from several threads at once, not even on a const list;
+        // once one query has been made after the last modification, the next ones only read and may run
+        // at the same time
+
+        // returns true if first comes before second in this list, O(1)
+        [[nodiscard]]
+        bool precedes(const_iterator first, const_iterator second) const noexcept {
+            ensure_labelled();
+            if (_reversed && first.node() != &_node && second.node() != &_node) {
+                return second.node()->label() < first.node()->label();
+            }
+            return label(first.node()) < label(second.node());
+        }
+
+        // estimates the number of steps from first to second (negative if second comes first)
+        // assuming the labels are spread evenly, which holds right after a relabelling; O(1)
+        [[nodiscard]]
+        std::ptrdiff_t approximate_distance(const_iterator first, const_iterator second) const noexcept {
+            if (empty()) {
+                return 0;
+            }
+            ensure_labelled();
+            // the labels of the elements span [head, tail], end() is one average step beyond the last element
+            double span = static_cast<double>(tail()->label() - head()->label());
+            size_type n = size();
+            double step = n > 1 && span > 0 ? span / static_cast<double>(n - 1) : 1.0;
+            auto key = [this](const node_t* node) {
+                return _reversed ? -static_cast<double>(node->label()) : static_cast<double>(node->label());
+            };
+            auto position = [this, step, &key](const node_t* node) {
+                return node == &_node ? key(last()) + step : key(node);
+            };
+            double distance = (position(second.node()) - position(first.node())) / step;
+            return static_cast<std::ptrdiff_t>(distance + (distance < 0 ? -0.5 : 0.5));
+        }
+
+    private:
+
+        // the labels of the elements are in [0, label_limit), end() uses label_limit itself
+        static constexpr std::uint64_t label_limit = std::uint64_t{1} << 62u;
+        static constexpr std::uint64_t label_stride = std::uint64_t{1} << 32u;
+
+        // appends the n values that first points to. The nodes are built in one block and linked in a
+        // single pass, the labels are given out by the next order query
+        template<typename _Iter>
+        void append_block(_Iter first, size_type n) {
+            if (n == 0) {
+                return;
+            }
+            normalize();
+            touch();
+            auto block = std::make_shared<block_t>(n);
+            node_t* prev = tail();
+            size_type built = 0;
+            try {
+                // every new node is linked to the one before it right away, the block is written once
+                for (; built < n; ++built, ++first) {
+                    node_t* node = block->construct(built, *first, prev);
+                    node->set_in_block();
+                    if (built > 0) {
+                        prev->_next = link_type(node);
+                    }
+                    prev = node;
+                }
+            } catch (...) {
+                // the links would destroy the nodes a second time
+                for (size_type i = 0; i < built; ++i) {
+                    block->at(i)->_next.release();
+                }
+                block->destroy(built);
+                throw;
+            }
+            // the last new node takes over the sentinel from the tail
+            block->at(n - 1)->_next = std::move(tail()->_next);
+            tail()->_next = link_type(block->at(0));
+            _node._prev = block->at(n - 1);
+            _size.add(n);
+            _labelled = false;
+            _arena.adopt(std::move(block));
+        }
+
+        // a node for an insertion: in a slot that reserve() set aside, or else from the pool
+        template<typename... Args>
+        link_type make_node(Args&& ... args) {
+            if (_arena.available()) {
+                return node_t::block_link(_arena.make(std::forward<Args>(args)...));
+            }
+            _in_blocks = false;
+            return _pool.make(std::forward<Args>(args)...);
+        }
+
+        // the list changed, the flat view has to be rebuilt
+        void touch() noexcept {
+            _flat_valid = false;
+        }
+
+        // an element may be changed through a reference, only a view with copies has to be rebuilt
+        void touch_values() noexcept {
+            if constexpr (flat_copies) {
+                _flat_valid = false;
+            }
+        }
+
+        [[nodiscard]]
+        std::uint64_t label(const node_t* node) const noexcept {
+            return node == &_node ? label_limit : node->label();
+        }
+
+        // spreads the labels evenly over the list, centered in the label space, O(n)
+        void relabel_all() const noexcept {
+            size_type n = size();
+            std::uint64_t step = std::min<std::uint64_t>(label_stride, label_limit / (n + 1));
+            std::uint64_t next_label = (label_limit - step * n) / 2;
+            for (node_t* node = head(); node != &_node; node = node->next()) {
+                node->set_label(next_label);
+                next_label += step;
+            }
+            _labelled = true;
+        }
+
+        void ensure_labelled() const noexcept {
+            if (!_labelled) {
+                relabel_all();
+            }
+        }
+
+        // moves the nodes [first_node, end_node) of other in front of pos_node, both lists are normalized
+        // and their sizes updated
+        void relink_range(node_t* pos_node, list& other, node_t* first_node, node_t* end_node) {
+            _labelled = false;
+            touch();
+            other.touch();
+            if (&other != this) {
+                _arena.share(other._arena);
+                _in_blocks = _in_blocks && other._in_blocks;
+            }
+            node_t* last_node = end_node->prev();
+            node_t* before = first_node->prev();
+            // take the range out of other
+            auto range = std::move(before->_next);
+            before->_next = std::move(last_node->_next);
+            before->next()->_prev = before;
+            // and link it in front of pos
+            node_t* pos_prev = pos_node->prev();
+            last_node->_next = std::move(pos_prev->_next);
+            pos_node->_prev = last_node;
+            first_node->_prev = pos_prev;
+            pos_prev->_next = std::move(range);
+        }
+
+        // sort() and merge() work on chains: nodes linked by _next only, the last one links to nothing.
+        // The links of a chain don't own, a node is owned again once the chain is adopted by the list
+        static void set_next(node_t* node, node_t* next) noexcept {
+            node->_next.release();
+            node->_next.reset(next);
+        }
+
+        // appends chain b to chain a
+        static node_t* concat(node_t* a, node_t* b) noexcept {
+            if (!a) {
+                return b;
+            }
+            node_t* end = a;
+            while (end->next()) {
+                end = end->next();
+            }
+            set_next(end, b);
+            return a;
+        }
+
+        // sorts a chain: sorted runs of 2^i nodes are kept in bins[i], every node is carried in at bin 0
+        // and merged upwards like a binary counter; finally the bins are merged from small to large
+        // when comp throws, chain holds all the nodes in some order
+        template<typename _Comp>
+        static void sort_chain(node_t*& chain, _Comp& comp) {
+            node_t* input = chain;
+            chain = nullptr;
+            // a higher bin holds earlier nodes than a lower one, that keeps the merges stable
+            node_t* bins[64] = {};
+            node_t* sorted = nullptr;
+            try {
+                while (input) {
+                    node_t* carry = input;
+                    input = input->next();
+                    set_next(carry, nullptr);
+                    size_type i = 0;
+                    for (; bins[i]; ++i) {
+                        merge_chains(bins[i], carry, comp);
+                        carry = bins[i];
+                        bins[i] = nullptr;
+                    }
+                    bins[i] = carry;
+                }
+                for (auto& bin : bins) {
+                    if (bin) {
+                        node_t* newer = sorted;
+                        sorted = nullptr;
+                        merge_chains(bin, newer, comp);
+                        sorted = bin;
+                        bin = nullptr;
+                    }
+                }
+            } catch (...) {
+                // a merge that threw left its nodes in its first chain
+                chain = concat(input, sorted);
+                for (auto bin : bins) {
+                    chain = concat(chain, bin);
+                }
+                throw;
+            }
+            chain = sorted;
+        }
+
+        // merges the sorted chain b into the sorted chain a, on a tie the node of a comes first
+        // when comp throws, a holds all the nodes of both chains
+        template<typename _Comp>
+        static void merge_chains(node_t*& a, node_t* b, _Comp& comp) {
+            node_t* head = nullptr;
+            node_t* last = nullptr;
+            try {
+                while (a && b) {
+                    node_t*& from = comp(b->value(), a->value()) ? b : a;
+                    node_t* taken = from;
+                    from = from->next();
+                    if (from) {
+                        detail::prefetch(from->next());
+                    }
+                    if (last) {
+                        set_next(last, taken);
+                    } else {
+                        head = taken;
+                    }
+                    last = taken;
+                }
+            } catch (...) {
+                node_t* rest = concat(a, b);
+                if (last) {
+                    set_next(last, rest);
+                    a = head;
+                } else {
+                    a = rest;
+                }
+                throw;
+            }
+            node_t* rest = a ? a : b;
+            if (last) {
+                set_next(last, rest);
+                a = head;
+            } else {
+                a = rest;
+            }
+        }
+
+        // the k ranges of partition_points(), from the first element to stop
+        template<typename _Iter>
+        std::vector<std::pair<_Iter, _Iter>> cut(_Iter it, _Iter stop, size_type k) const {
+            std::vector<std::pair<_Iter, _Iter>> ranges;
+            ranges.reserve(k);
+            size_type n = size();
+            for (size_type i = 0; i < k; ++i) {
+                _Iter from = it;
+                for (size_type j = i * n / k; j < (i + 1) * n / k; ++j) {
+                    ++it;
+                }
+                ranges.emplace_back(from, i + 1 == k ? stop : it);
+            }
+            return ranges;
+        }
+
+        // relinks the nodes for which drop(last kept node or nullptr, node) is false and frees the
+        // others in one batch at the end. Returns the number of freed nodes
+        template<typename _Drop>
+        size_type drop_nodes(_Drop drop) {
+            normalize();
+            if (empty()) {
+                return 0;
+            }
+            touch();
+            node_t* input = take_chain();
+            node_t* kept = nullptr;
+            node_t* kept_tail = nullptr;
+            // the dropped nodes own each other from the first one on
+            link_type dropped;
+            node_t* dropped_tail = nullptr;
+            size_type count = 0;
+            try {
+                while (input) {
+                    node_t* node = input;
+                    bool dropping = drop(static_cast<const node_t*>(kept_tail), node);
+                    input = node->next();
+                    set_next(node, nullptr);
+                    if (dropping) {
+                        if (dropped_tail) {
+                            set_next(dropped_tail, node);
+                        } else {
+                            dropped.reset(node);
+                        }
+                        dropped_tail = node;
+                        ++count;
+                    } else {
+                        if (kept_tail) {
+                            set_next(kept_tail, node);
+                        } else {
+                            kept = node;
+                        }
+                        kept_tail = node;
+                    }
+                }
+            } catch (...) {
+                adopt_chain(concat(kept, input));
+                _size.subtract(count);
+                free_chain(std::move(dropped));
+                throw;
+            }
+            adopt_chain(kept);
+            _size.subtract(count);
+            free_chain(std::move(dropped));
+            return count;
+        }
+
+        // destroys the nodes of an owned chain iteratively
+        static void free_chain(link_type chain) noexcept {
+            while (chain) {
+                chain = std::move(chain->_next);
+            }
+        }
+
+        // takes the nodes out of the normalized list as a chain, the list has to adopt a chain again
+        node_t* take_chain() noexcept {
+            if (empty()) {
+                return nullptr;
+            }
+            tail()->_next.release();
+            return _node._next.release();
+        }
+
+        // makes chain the content of the list: restores the _prev links and the ownership
+        void adopt_chain(node_t* chain) noexcept {
+            _node._next.release();
+            _node._next.reset(chain);
+            node_t* prev = &_node;
+            for (node_t* node = chain; node; node = node->next()) {
+                node->_prev = prev;
+                prev = node;
+            }
+            prev->_next.reset(&_node);
+            _node._prev = prev;
+        }
+
+        // the number of nodes in [first, last)
+        [[nodiscard]]
+        static size_type count(const node_t* first, const node_t* last) noexcept {
+            size_type n = 0;
+            for (; first != last; first = first->next()) {
+                ++n;
+            }
+            return n;
+        }
+
+        // nodes that are made before they are linked into the list, see insert(pos, first, last)
+        // the chain is destroyed iteratively when it is not linked, e.g. when a copy threw
+        struct chain {
+            link_type head;
+            node_t* tail = nullptr;
+            size_type length = 0;
+
+            chain() = default;
+
+            chain(chain&&) noexcept = default;
+
+            ~chain() noexcept {
+                while (head) {
+                    head = std::move(head->_next);
+                }
+            }
+        };
+
+        // makes the nodes for [first, last), linked in their logical order: backwards in a reversed list
+        template<typename _Iter>
+        chain make_chain(_Iter first, _Iter last) {
+            chain result;
+            for (; first != last; ++first) {
+                link_type created = make_node(*first, nullptr);
+                node_t* node = created.get();
+                if (!result.head) {
+                    result.head = std::move(created);
+                    result.tail = node;
+                } else if (_reversed) {
+                    result.head->_prev = node;
+                    node->_next = std::move(result.head);
+                    result.head = std::move(created);
+                } else {
+                    node->_prev = result.tail;
+                    result.tail->_next = std::move(created);
+                    result.tail = node;
+                }
+                ++result.length;
+            }
+            return result;
+        }
+
+        // links the nodes of a chain in front of pos, returns an iterator to the logically first of them
+        iterator link_chain(node_t* pos, chain& nodes) {
+            node_t* prev = pos->prev();
+            node_t* first = nodes.head.get();
+            node_t* last = nodes.tail;
+            first->_prev = prev;
+            last->_next = std::move(prev->_next);
+            pos->_prev = last;
+            prev->_next = std::move(nodes.head);
+            _size.add(nodes.length);
+            touch();
+            if (_labelled) {
+                label_run(first, last, nodes.length);
+            }
+            return iterator(_reversed ? last : first, _reversed);
+        }
+
+        // spreads the labels of n just linked nodes [first, last] evenly between their neighbours
+        // when the gap between the neighbours is too narrow, the next order query relabels the list
+        void label_run(node_t* first, node_t* last, size_type n) noexcept {
+            std::uint64_t low = first->prev() == &_node ? 0 : first->prev()->label() + 1;
+            std::uint64_t high = label(last->next());
+            if (high <= low || high - low < n) {
+                _labelled = false;
+                return;
+            }
+            std::uint64_t step = std::min<std::uint64_t>(label_stride, (high - low) / n);
+            for (node_t* node = first;; node = node->next()) {
+                node->set_label(low);
+                low += step;
+                if (node == last) {
+                    break;
+                }
+            }
+        }
+
+        // links a freshly created node in front of pos and returns an iterator to it
+        iterator link_before(node_t* pos, link_type created) {
+            node_t* prev = pos->prev();
+            created->_prev = prev;
+            created->_next = std::move(prev->_next);
+            pos->_prev = created.get();
+            prev->_next = std::move(created);
+            _size.add(1);
+            touch();
+            if (_labelled) {
+                assign_label(prev->next());
+            }
+            return iterator(prev->next(), _reversed);
+        }
+
+        // gives a just linked node a label between the labels of its neighbours
+        // if there is no free label between them, the neighbourhood is relabelled first
+        void assign_label(node_t* node) noexcept {
+            std::uint64_t low = node->prev() == &_node ? 0 : node->prev()->label() + 1;
+            std::uint64_t high = label(node->next());
+            if (low >= high) {
+                // the node itself is skipped while relabelling and labelled afterwards
+                relabel_around(node->prev() == &_node ? node->next() : node->prev(), node);
+                low = node->prev() == &_node ? 0 : node->prev()->label() + 1;
+                high = label(node->next());
+            }
+            if (node->prev() == &_node && node->next() == &_node) {
+                // the first element starts in the middle, leaving room on both sides
+                node->set_label(label_limit / 2);
+            } else if (node->next() == &_node && high - low > label_stride) {
+                // appending and prepending use a fixed stride, so that lists built from either end
+                // are labelled evenly instead of halving the remaining label space each time
+                node->set_label(low - 1 + label_stride);
+            } else if (node->prev() == &_node && high > label_stride) {
+                node->set_label(high - label_stride);
+            } else {
+                node->set_label(low + (high - low) / 2);
+            }
+        }
+
+        // the tag-range relabelling of the order-maintenance problem (Bender et al.):
+        // look at the aligned label ranges of growing size 2^k around the anchor and spread the
+        // nodes of the first one that is sparse enough (at most (2/T)^k nodes) evenly over it.
+        // the ranges double in size, which makes an insertion cost amortized O(log n)
+        void relabel_around(node_t* anchor, const node_t* skipped) noexcept {
+            constexpr double growth = 2.0 / 1.3;    // 2/T for the density threshold T = 1.3
+            node_t* first = anchor;
+            node_t* last = anchor;
+            size_type count = 1;
+            double allowed = 1.0;
+            for (unsigned bits = 1; bits <= 62; ++bits) {
+                std::uint64_t width = std::uint64_t{1} << bits;
+                std::uint64_t range_low = anchor->label() & ~(width - 1);
+                std::uint64_t range_high = range_low + width;
+                allowed *= growth;
+                // extend [first, last] to all the labelled nodes in [range_low, range_high)
+                for (node_t* prev = first->prev();
+                     prev != &_node && (prev == skipped || prev->label() >= range_low);
+                     prev = first->prev()) {
+                    first = prev;
+                    count += prev != skipped;
+                }
+                for (node_t* next = last->next();
+                     next != &_node && (next == skipped || next->label() < range_high);
+                     next = last->next()) {
+                    last = next;
+                    count += next != skipped;
+                }
+                // one more node has to fit in and every gap has to be at least 2 wide
+                if (bits == 62 || (static_cast<double>(count + 1) <= allowed && (count + 1) * 2 <= width)) {
+                    if (bits == 62) {
+                        // the whole label space is too dense: spread the whole list over it
+                        first = head();
+                        last = tail();
+                        count = size() - 1;
+                        range_low = 0;
+                    }
+                    std::uint64_t step = width / (count + 1);
+                    std::uint64_t next_label = range_low + step;
+                    for (node_t* current = first;; current = current->next()) {
+                        if (current != skipped) {
+                            current->set_label(next_label);
+                            next_label += step;
+                        }
+                        if (current == last) {
+                            break;
+                        }
+                    }
+                    return;
+                }
+            }
+        }
+
+        // the node in front of which an element is linked to end up logically before pos
+        [[nodiscard]]
+        node_t* position(iterator pos) const noexcept {
+            return _reversed ? pos.node()->next() : pos.node();
+        }
+
+        // walks from whichever end of the list is closer
+        [[nodiscard]]
+        node_t* node_at(size_type index) const {
+            size_type n = size();
+            if (_reversed) {
+                index = n - 1 - index;
+            }
+            if (index < n / 2) {
+                node_t* current = head();
+                while (index--) { current = current->next(); }
+                return current;
+            }
+            node_t* current = tail();
+            for (index = n - 1 - index; index; --index) { current = current->prev(); }
+            return current;
+        }
+
+        // after the sentinel node was swapped, its neighbours still point at the old sentinel
+        void relink_sentinel() noexcept {
+            if (_node.next() == &_node) {
+                _node._prev = &_node;
+            } else {
+                _node.next()->_prev = &_node;
+            }
+        }
+
+        template<typename _Key>
+        [[nodiscard]]
+        const node_t* find_node(const _Key& key) const {
+            const auto& probe = node_t::probe(key);
+            if (_reversed) {
+                for (const node_t* node = tail(); node != &_node; node = node->prev()) {
+                    if (node->matches(probe)) {
+                        return node;
+                    }
+                }
+                return &_node;
+            }
+            for (const node_t* node = head(); node != &_node; node = node->next()) {
+                if (node->matches(probe)) {
+                    return node;
+                }
+            }
+            return &_node;
         }
 
     };
@@ -573,8 +2083,8 @@ namespace saxion {
 }
 
 namespace std{
-    template<typename _T>
-    inline void swap(saxion::list<_T>& x, saxion::list <_T>& y) noexcept {
+    template<typename _T, typename _SizePolicy, typename _Nd>
+    inline void swap(saxion::list<_T, _SizePolicy, _Nd>& x, saxion::list <_T, _SizePolicy, _Nd>& y) noexcept {
         x.swap(y);
     }
 }
@@ -0,0 +1,129 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef INCLUDE_LIST_NODES_H
+#define INCLUDE_LIST_NODES_H
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "huge_page_arena.h"
+#include "list.h"
+#include "forward_list.h"
+
+// nodes that can replace the default node of a list or forward_list through its node template parameter:
+//      saxion::list<std::string, saxion::eager_size, saxion::cached_hash_node<std::string>>
+//      saxion::forward_list<record, saxion::eager_size, saxion::forward_key_node<record, by_id>>
+// a node derives from the default node of the container (_Links) and passes itself as the type of its links.
+// The extra data is computed when the node is constructed, and again when the container assigns a new
+// value to the node (assign() of the containers reuses nodes): an element that is changed through
+// a reference has to keep the same hash or key.
+
+namespace saxion {
+
+    // caches the hash of the value, find() then compares hashes and only compares the values
+    // when the hashes are equal. Pays off when comparing values is expensive, e.g. long strings
+    template<typename _T, typename _Hash = std::hash<_T>,
+            template<typename, typename> class _Links = detail::list_node_t>
+    struct cached_hash_node : _Links<_T, cached_hash_node<_T, _Hash, _Links>> {
+        using base_type = _Links<_T, cached_hash_node<_T, _Hash, _Links>>;
+        using base_type::base_type;
+
+        // what find() compares the nodes with
+        struct probe_type {
+            std::size_t hash;
+            const _T& value;
+        };
+
+        // the default member initializer runs after the base (and so the value) is constructed
+        std::size_t _hash = _Hash{}(this->_value);
+
+        [[nodiscard]]
+        std::size_t hash() const noexcept {
+            return _hash;
+        }
+
+        template<typename _V>
+        void assign(_V&& value) {
+            base_type::assign(std::forward<_V>(value));
+            _hash = _Hash{}(this->_value);
+        }
+
+        [[nodiscard]]
+        static probe_type probe(const _T& value) {
+            return {_Hash{}(value), value};
+        }
+
+        [[nodiscard]]
+        bool matches(const probe_type& probe) const {
+            return _hash == probe.hash && this->_value == probe.value;
+        }
+    };
+
+    // stores the key that _KeyFn projects from the value next to the links, find() takes a key and
+    // compares it without touching the (possibly large) value. The key has to be cheap to copy
+    template<typename _T, typename _KeyFn,
+            template<typename, typename> class _Links = detail::list_node_t>
+    struct key_node : _Links<_T, key_node<_T, _KeyFn, _Links>> {
+        using base_type = _Links<_T, key_node<_T, _KeyFn, _Links>>;
+        using base_type::base_type;
+
+        using key_type = std::decay_t<std::invoke_result_t<_KeyFn, const _T&>>;
+
+        static constexpr bool trivial_payload = base_type::trivial_payload && std::is_trivially_destructible_v<key_type>;
+
+        key_type _key = _KeyFn{}(std::as_const(this->_value));
+
+        [[nodiscard]]
+        const key_type& key() const noexcept {
+            return _key;
+        }
+
+        template<typename _V>
+        void assign(_V&& value) {
+            base_type::assign(std::forward<_V>(value));
+            _key = _KeyFn{}(std::as_const(this->_value));
+        }
+
+        [[nodiscard]]
+        static const key_type& probe(const key_type& key) noexcept {
+            return key;
+        }
+
+        [[nodiscard]]
+        bool matches(const key_type& key) const {
+            return _key == key;
+        }
+    };
+
+    // takes its memory from the huge_page_arena of the node type instead of the heap, so the nodes of
+    // huge lists are packed together on huge pages. Pays off for lists of millions of nodes, where a
+    // traversal is dominated by TLB misses; the memory of freed nodes stays with the arena
+    template<typename _T, template<typename, typename> class _Links = detail::list_node_t>
+    struct huge_page_node : _Links<_T, huge_page_node<_T, _Links>> {
+        using base_type = _Links<_T, huge_page_node<_T, _Links>>;
+        using base_type::base_type;
+
+        static void* operator new(std::size_t bytes) {
+            return huge_page_arena::of<huge_page_node>().allocate(bytes);
+        }
+
+        static void operator delete(void* memory, std::size_t bytes) noexcept {
+            huge_page_arena::of<huge_page_node>().deallocate(memory, bytes);
+        }
+    };
+
+    // the same nodes for the forward_list
+    template<typename _T, typename _Hash = std::hash<_T>>
+    using forward_cached_hash_node = cached_hash_node<_T, _Hash, detail::forward_list_node_t>;
+
+    template<typename _T, typename _KeyFn>
+    using forward_key_node = key_node<_T, _KeyFn, detail::forward_list_node_t>;
+
+    template<typename _T>
+    using forward_huge_page_node = huge_page_node<_T, detail::forward_list_node_t>;
+}
+
+#endif //INCLUDE_LIST_NODES_H
@@ -0,0 +1,316 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef INCLUDE_NODE_POOL_H
+#define INCLUDE_NODE_POOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "huge_page_arena.h"
+
+namespace saxion {
+
+    // what clear() does with the nodes of a list or forward_list
+    enum class clear_mode {
+        // the nodes are freed
+        release,
+        // the values are destroyed, but the memory of the nodes is kept for the next insertions
+        retain
+    };
+
+    namespace detail {
+
+        // asks for the memory of a node that is about to be read, the walks over scattered nodes
+        // (sorting, merging) would otherwise wait for every node in turn
+        inline void prefetch(const void* address) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(address);
+#else
+            (void) address;
+#endif
+        }
+
+        // a node may bring its own memory (see huge_page_node): a class-specific operator new,
+        // with a sized operator delete to go with it
+        template<typename _Nd, typename = void>
+        struct has_node_allocator : std::false_type {};
+
+        template<typename _Nd>
+        struct has_node_allocator<_Nd, std::void_t<decltype(_Nd::operator new(std::size_t{}))>> : std::true_type {};
+
+        // memory for n nodes, from the same allocation function that new _Nd uses for one node
+        template<typename _Nd>
+        void* allocate_nodes(std::size_t n) {
+            if constexpr (has_node_allocator<_Nd>::value) {
+                return _Nd::operator new(n * sizeof(_Nd));
+            } else if constexpr (alignof(_Nd) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                return ::operator new(n * sizeof(_Nd), std::align_val_t{alignof(_Nd)});
+            } else {
+                return ::operator new(n * sizeof(_Nd));
+            }
+        }
+
+        template<typename _Nd>
+        void deallocate_nodes(void* memory, std::size_t n) noexcept {
+            if constexpr (has_node_allocator<_Nd>::value) {
+                _Nd::operator delete(memory, n * sizeof(_Nd));
+            } else if constexpr (alignof(_Nd) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                ::operator delete(memory, n * sizeof(_Nd), std::align_val_t{alignof(_Nd)});
+            } else {
+                ::operator delete(memory, n * sizeof(_Nd));
+            }
+        }
+
+        // a chain of unused node-sized blocks of memory, owned by one container
+        // the blocks come from the same allocation function as new _Nd, so a node that was built in a
+        // recycled block can still be owned (and deleted) by an ordinary link of the node
+        template<typename _Nd>
+        class node_pool {
+        public:
+            using size_type = std::size_t;
+
+            node_pool() noexcept:
+                    _free{nullptr},
+                    _size{0} {}
+
+            node_pool(const node_pool&) = delete;
+
+            node_pool& operator=(const node_pool&) = delete;
+
+            ~node_pool() noexcept {
+                release();
+            }
+
+            void swap(node_pool& other) noexcept {
+                std::swap(_free, other._free);
+                std::swap(_size, other._size);
+            }
+
+            // builds a node in a free block, or in a new one when there is none
+            template<typename... Args>
+            typename _Nd::link_type make(Args&& ... args) {
+                using link_type = typename _Nd::link_type;
+                if (!_free) {
+                    return link_type(new _Nd(std::forward<Args>(args)...));
+                }
+                void* block = take();
+                try {
+                    return link_type(::new(block) _Nd(std::forward<Args>(args)...));
+                } catch (...) {
+                    put(block);
+                    throw;
+                }
+            }
+
+            // destroys the node, but keeps its memory
+            void recycle(_Nd* node) noexcept {
+                node->~_Nd();
+                put(node);
+            }
+
+            // makes sure there are at least n free blocks
+            void reserve(size_type n) {
+                while (_size < n) {
+                    put(allocate());
+                }
+            }
+
+            // frees all the blocks
+            void release() noexcept {
+                while (_free) {
+                    deallocate(take());
+                }
+            }
+
+            // the number of free blocks
+            [[nodiscard]]
+            size_type size() const noexcept {
+                return _size;
+            }
+
+        private:
+
+            // a free block holds the link to the next free block
+            struct free_block {
+                free_block* next;
+            };
+
+            static_assert(sizeof(_Nd) >= sizeof(free_block), "a node has to be able to hold a link");
+
+            free_block* _free;
+            size_type _size;
+
+            void put(void* block) noexcept {
+                _free = new(block) free_block{_free};
+                ++_size;
+            }
+
+            void* take() noexcept {
+                free_block* block = _free;
+                _free = block->next;
+                --_size;
+                return block;
+            }
+
+            static void* allocate() {
+                return allocate_nodes<_Nd>(1);
+            }
+
+            static void deallocate(void* block) noexcept {
+                deallocate_nodes<_Nd>(block, 1);
+            }
+        };
+
+        // n nodes of contiguous memory that are built and destroyed by their owner
+        // the nodes are marked to live in the block, so their links don't delete them
+        template<typename _Nd>
+        class node_block {
+        public:
+            using size_type = std::size_t;
+
+            explicit node_block(size_type capacity) :
+                    _nodes{static_cast<_Nd*>(allocate_nodes<_Nd>(capacity))},
+                    _capacity{capacity} {
+                advise_huge_pages(_nodes, capacity * sizeof(_Nd));
+            }
+
+            node_block(const node_block&) = delete;
+
+            node_block& operator=(const node_block&) = delete;
+
+            ~node_block() noexcept {
+                deallocate_nodes<_Nd>(_nodes, _capacity);
+            }
+
+            template<typename... Args>
+            _Nd* construct(size_type index, Args&& ... args) {
+                return ::new(_nodes + index) _Nd(std::forward<Args>(args)...);
+            }
+
+            // destroys the first n nodes, for a block that never got linked
+            void destroy(size_type n) noexcept {
+                for (size_type i = 0; i < n; ++i) {
+                    _nodes[i].~_Nd();
+                }
+            }
+
+            [[nodiscard]]
+            _Nd* at(size_type index) const noexcept {
+                return _nodes + index;
+            }
+
+            [[nodiscard]]
+            size_type capacity() const noexcept {
+                return _capacity;
+            }
+
+        private:
+            _Nd* _nodes;
+            size_type _capacity;
+        };
+
+        // the blocks of nodes that a list owns, and the slots of the newest block that reserve() set
+        // aside for the next insertions. A block is shared with the lists that nodes of it are spliced
+        // into, the last list to let go of it frees it. The slot of a node in a block is only reused
+        // once the whole block is free again: for a list that was cleared, see release()
+        template<typename _Nd>
+        class node_arena {
+        public:
+            using size_type = std::size_t;
+            using block_type = node_block<_Nd>;
+
+            node_arena() noexcept:
+                    _blocks{},
+                    _spare{nullptr},
+                    _used{0} {}
+
+            node_arena(const node_arena&) = delete;
+
+            node_arena& operator=(const node_arena&) = delete;
+
+            void swap(node_arena& other) noexcept {
+                _blocks.swap(other._blocks);
+                std::swap(_spare, other._spare);
+                std::swap(_used, other._used);
+            }
+
+            // the set aside slots that are not used yet
+            [[nodiscard]]
+            size_type available() const noexcept {
+                return _spare ? _spare->capacity() - _used : 0;
+            }
+
+            // sets a new block of n slots aside, the unused slots of the previous one are given up
+            void reserve(size_type n) {
+                auto block = std::make_shared<block_type>(n);
+                _blocks.push_back(block);
+                _spare = block.get();
+                _used = 0;
+            }
+
+            // builds a node in the next set aside slot, there has to be one available
+            template<typename... Args>
+            _Nd* make(Args&& ... args) {
+                _Nd* node = _spare->construct(_used, std::forward<Args>(args)...);
+                ++_used;
+                return node;
+            }
+
+            // a block that the owner filled itself
+            void adopt(std::shared_ptr<block_type> block) {
+                _blocks.push_back(std::move(block));
+            }
+
+            // nodes of other's blocks move into the owner, so it keeps those blocks alive as well
+            void share(const node_arena& other) {
+                for (auto& block : other._blocks) {
+                    if (std::find(_blocks.begin(), _blocks.end(), block) == _blocks.end()) {
+                        _blocks.push_back(block);
+                    }
+                }
+            }
+
+            // for an owner that has no nodes any more: lets go of the blocks, except for the set aside one
+            // while it has unused slots. With rewind, all the slots of the set aside block are handed out
+            // again, as long as no other list holds nodes of it
+            void release(bool rewind = false) noexcept {
+                std::shared_ptr<block_type> spare;
+                for (auto& block : _blocks) {
+                    if (block.get() == _spare) {
+                        spare = std::move(block);
+                    }
+                }
+                _blocks.clear();
+                if (spare && rewind && spare.use_count() == 1) {
+                    _used = 0;
+                }
+                if (spare && available() > 0) {
+                    _blocks.push_back(std::move(spare));
+                } else {
+                    _spare = nullptr;
+                    _used = 0;
+                }
+            }
+
+            // stops handing out the set aside slots, the blocks stay while they hold nodes
+            void forget_spare() noexcept {
+                _spare = nullptr;
+                _used = 0;
+            }
+
+        private:
+            std::vector<std::shared_ptr<block_type>> _blocks;
+            block_type* _spare;
+            size_type _used;
+        };
+    }
+}
+
+#endif //INCLUDE_NODE_POOL_H
@@ -0,0 +1,224 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef INCLUDE_PARALLEL_H
+#define INCLUDE_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "forward_list.h"
+#include "list.h"
+#include "thread_pool.h"
+
+namespace saxion {
+
+    // the number of threads the parallel algorithms use when none is given
+    inline std::size_t default_threads() noexcept {
+        return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+
+    namespace detail {
+        // parallel_for_each() and parallel_transform_reduce() cut the list in this many ranges per
+        // thread. A thread takes the next range as soon as it is done with one, so when the elements
+        // of some ranges take longer, the other threads pick up the rest instead of waiting
+        constexpr std::size_t ranges_per_thread = 8;
+    }
+
+    // sorts lst with up to threads threads. One pass cuts the list in equal parts, the parts are sorted
+    // at the same time with the relinking merge sort of list::sort(), and neighbouring parts are merged
+    // pairwise in rounds, the pairs of a round at the same time. Only the links change, no value is
+    // moved or copied; every task uses its own copy of comp. Stable, like list::sort()
+    // when comp throws, all the elements are still in the list, in an unspecified order
+    template<typename _T, typename _SizePolicy, typename _Nd, typename _Comp>
+    void parallel_sort(list<_T, _SizePolicy, _Nd>& lst, _Comp comp, std::size_t threads) {
+        using list_type = list<_T, _SizePolicy, _Nd>;
+        using node_t = _Nd;
+        // a part shorter than this is not worth a thread of its own
+        constexpr std::size_t min_part = std::size_t{1} << 14u;
+
+        lst.normalize();
+        std::size_t n = lst.size();
+        std::size_t parts = std::min(threads, n / min_part);
+        if (parts <= 1) {
+            lst.sort(comp);
+            return;
+        }
+        lst.touch();
+        lst._labelled = false;
+
+        std::vector<node_t*> chains(parts);
+        node_t* rest = lst.take_chain();
+        for (std::size_t i = 0; i < parts; ++i) {
+            std::size_t length = (i + 1) * n / parts - i * n / parts;
+            node_t* last = rest;
+            for (std::size_t j = 1; j < length; ++j) {
+                last = last->next();
+            }
+            chains[i] = rest;
+            rest = last->next();
+            list_type::set_next(last, nullptr);
+        }
+
+        thread_pool pool(parts);
+        try {
+            pool.run(parts, [&chains, &comp](std::size_t i) {
+                _Comp own = comp;
+                list_type::sort_chain(chains[i], own);
+            });
+            // chain i + width is merged into chain i, the earlier chain wins the ties
+            for (std::size_t width = 1; width < parts; width *= 2) {
+                std::size_t pairs = (parts + width - 1) / (2 * width);
+                pool.run(pairs, [&chains, &comp, width](std::size_t pair) {
+                    std::size_t i = pair * 2 * width;
+                    node_t* later = chains[i + width];
+                    chains[i + width] = nullptr;
+                    _Comp own = comp;
+                    list_type::merge_chains(chains[i], later, own);
+                });
+            }
+        } catch (...) {
+            node_t* all = nullptr;
+            for (node_t* chain : chains) {
+                all = list_type::concat(all, chain);
+            }
+            lst.adopt_chain(all);
+            throw;
+        }
+        lst.adopt_chain(chains[0]);
+    }
+
+    template<typename _T, typename _SizePolicy, typename _Nd, typename _Comp>
+    void parallel_sort(list<_T, _SizePolicy, _Nd>& lst, _Comp comp) {
+        parallel_sort(lst, std::move(comp), default_threads());
+    }
+
+    template<typename _T, typename _SizePolicy, typename _Nd>
+    void parallel_sort(list<_T, _SizePolicy, _Nd>& lst) {
+        parallel_sort(lst, std::less<>(), default_threads());
+    }
+
+    // calls fn on every element of lst with up to threads threads, in no particular order. The ranges
+    // of lst.partition_points() are handed out to the threads one by one, every range gets its own
+    // copy of fn. When fn throws, the other ranges are still visited and the first exception is rethrown
+    template<typename _T, typename _SizePolicy, typename _Nd, typename _Fn>
+    void parallel_for_each(list<_T, _SizePolicy, _Nd>& lst, _Fn fn, std::size_t threads) {
+        std::size_t parts = std::min(lst.size(), threads * detail::ranges_per_thread);
+        if (threads <= 1 || parts <= 1) {
+            std::for_each(lst.begin(), lst.end(), fn);
+            return;
+        }
+        auto ranges = lst.partition_points(parts);
+        thread_pool pool(std::min(threads, parts));
+        pool.run(parts, [&ranges, &fn](std::size_t i) {
+            std::for_each(ranges[i].first, ranges[i].second, fn);
+        });
+    }
+
+    template<typename _T, typename _SizePolicy, typename _Nd, typename _Fn>
+    void parallel_for_each(list<_T, _SizePolicy, _Nd>& lst, _Fn fn) {
+        parallel_for_each(lst, std::move(fn), default_threads());
+    }
+
+    // reduce(init, transform(element)) over all the elements of lst, with up to threads threads. Every
+    // range of lst.partition_points() is reduced on its own and the results are combined in list order,
+    // so reduce has to be associative but not commutative; the result doesn't depend on threads.
+    // transform and reduce are shared: they are called from several threads at the same time
+    template<typename _T, typename _SizePolicy, typename _Nd, typename _R, typename _Reduce, typename _Transform>
+    _R parallel_transform_reduce(const list<_T, _SizePolicy, _Nd>& lst, _R init, _Reduce reduce,
+                                 _Transform transform, std::size_t threads) {
+        std::size_t parts = std::min(lst.size(), threads * detail::ranges_per_thread);
+        if (threads <= 1 || parts <= 1) {
+            for (const auto& value : lst) {
+                init = reduce(std::move(init), transform(value));
+            }
+            return init;
+        }
+        // parts is at most the size, so no range is empty
+        auto ranges = lst.partition_points(parts);
+        std::vector<std::optional<_R>> partials(parts);
+        thread_pool pool(std::min(threads, parts));
+        pool.run(parts, [&ranges, &partials, &reduce, &transform](std::size_t i) {
+            auto it = ranges[i].first;
+            _R partial = transform(*it);
+            for (++it; it != ranges[i].second; ++it) {
+                partial = reduce(std::move(partial), transform(*it));
+            }
+            partials[i] = std::move(partial);
+        });
+        for (auto& partial : partials) {
+            init = reduce(std::move(init), std::move(*partial));
+        }
+        return init;
+    }
+
+    template<typename _T, typename _SizePolicy, typename _Nd, typename _R, typename _Reduce, typename _Transform>
+    _R parallel_transform_reduce(const list<_T, _SizePolicy, _Nd>& lst, _R init, _Reduce reduce,
+                                 _Transform transform) {
+        return parallel_transform_reduce(lst, std::move(init), std::move(reduce), std::move(transform),
+                                         default_threads());
+    }
+
+    // builds a forward_list of transform(element) for the elements of range, in order, with up to threads
+    // threads. The range is cut in one shard per thread; every thread fills a list of its own from its
+    // shard, in one block of nodes, and those lists are spliced together in input order, O(1) each.
+    // The threads read the range at the same time, so it has to be a forward range, and they share
+    // transform. When transform throws, the other shards are still built (and freed), and the first
+    // exception is rethrown
+    template<typename _Range, typename _Transform>
+    auto parallel_build(_Range&& range, _Transform transform, std::size_t threads) {
+        using iterator = decltype(std::begin(range));
+        static_assert(std::is_base_of_v<std::forward_iterator_tag,
+                              typename std::iterator_traits<iterator>::iterator_category>,
+                      "parallel_build needs a range that can be read more than once");
+        using value_type = std::decay_t<std::invoke_result_t<_Transform&, decltype(*std::begin(range))>>;
+        using list_type = forward_list<value_type>;
+        // a shard shorter than this is not worth a thread of its own
+        constexpr std::size_t min_shard = std::size_t{1} << 12u;
+
+        iterator it = std::begin(range);
+        auto n = static_cast<std::size_t>(std::distance(it, std::end(range)));
+        std::size_t parts = std::max<std::size_t>(1, std::min(threads, n / min_shard));
+        // shard i is [bounds[i], bounds[i + 1]) and has lengths[i] elements
+        std::vector<iterator> bounds;
+        std::vector<std::size_t> lengths;
+        bounds.reserve(parts + 1);
+        lengths.reserve(parts);
+        for (std::size_t i = 0; i < parts; ++i) {
+            bounds.push_back(it);
+            lengths.push_back((i + 1) * n / parts - i * n / parts);
+            std::advance(it, lengths.back());
+        }
+        bounds.push_back(it);
+
+        std::vector<list_type> shards(parts);
+        thread_pool pool(parts);
+        pool.run(parts, [&bounds, &lengths, &shards, &transform](std::size_t i) {
+            list_type& shard = shards[i];
+            shard.reserve(lengths[i]);
+            for (iterator element = bounds[i]; element != bounds[i + 1]; ++element) {
+                shard.emplace_back(transform(*element));
+            }
+        });
+        // from the last shard to the first, each one in front of the ones after it
+        list_type result;
+        for (std::size_t i = parts; i-- > 0;) {
+            result.splice_after(result.before_begin(), shards[i]);
+        }
+        return result;
+    }
+
+    template<typename _Range, typename _Transform>
+    auto parallel_build(_Range&& range, _Transform transform) {
+        return parallel_build(std::forward<_Range>(range), std::move(transform), default_threads());
+    }
+}
+
+#endif //INCLUDE_PARALLEL_H
@@ -0,0 +1,121 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef INCLUDE_RECLAIMER_H
+#define INCLUDE_RECLAIMER_H
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace saxion {
+
+    // destroys what it is handed on a background thread, so a thread that has to let go of a huge
+    // container doesn't pay for freeing every node itself. The thread is started by the first
+    // post(); the destructor waits until everything that was posted is destroyed and joins it
+    class reclaimer {
+    public:
+
+        // anything that can be reclaimed: its destructor does the work
+        struct garbage {
+            virtual ~garbage() = default;
+        };
+
+        // owns a value until the reclaimer destroys it
+        template<typename _T>
+        struct holder : garbage {
+            _T value;
+        };
+
+        reclaimer() :
+                _mutex{},
+                _wake{},
+                _idle{},
+                _queue{},
+                _worker{},
+                _busy{false},
+                _stopped{false} {}
+
+        reclaimer(const reclaimer&) = delete;
+
+        reclaimer& operator=(const reclaimer&) = delete;
+
+        ~reclaimer() noexcept {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopped = true;
+            }
+            _wake.notify_one();
+            if (_worker.joinable()) {
+                _worker.join();
+            }
+        }
+
+        // the reclaimer of the program, the one detach_and_reclaim() posts to. It is destroyed with the
+        // other statics, after main returns: the values that are still queued are destroyed then, while
+        // the statics that existed before the first post() are still alive
+        static reclaimer& instance() {
+            static reclaimer instance;
+            return instance;
+        }
+
+        // once the reclaimer is stopping, item is destroyed right here
+        void post(std::unique_ptr<garbage> item) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_stopped) {
+                    if (!_worker.joinable()) {
+                        _worker = std::thread(&reclaimer::run, this);
+                    }
+                    _queue.push_back(std::move(item));
+                    _wake.notify_one();
+                    return;
+                }
+            }
+            item.reset();
+        }
+
+        // waits until everything that was posted before is destroyed
+        void flush() {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _idle.wait(lock, [this]() { return _queue.empty() && !_busy; });
+        }
+
+    private:
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::condition_variable _idle;
+        std::vector<std::unique_ptr<garbage>> _queue;
+        std::thread _worker;
+        bool _busy;
+        bool _stopped;
+
+        void run() {
+            std::vector<std::unique_ptr<garbage>> batch;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _busy = false;
+                    if (_queue.empty()) {
+                        _idle.notify_all();
+                    }
+                    _wake.wait(lock, [this]() { return !_queue.empty() || _stopped; });
+                    // a stopping reclaimer still empties its queue first
+                    if (_queue.empty()) {
+                        return;
+                    }
+                    batch.swap(_queue);
+                    _busy = true;
+                }
+                // the destructors run without the lock, post() doesn't wait for them
+                batch.clear();
+            }
+        }
+    };
+}
+
+#endif //INCLUDE_RECLAIMER_H
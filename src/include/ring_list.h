@@ -0,0 +1,451 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef INCLUDE_RING_LIST_H
+#define INCLUDE_RING_LIST_H
+
+#include <type_traits>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+
+namespace saxion {
+
+    //forward declaration of the class ring_list
+    template<typename _T>
+    class ring_list;
+
+    namespace detail {
+        template<typename _T, typename _Nd>
+        class ring_list_iterator;
+
+        template<typename _T, typename _Nd>
+        class const_ring_list_iterator;
+    }
+
+    namespace detail {
+
+        // the nodes of a ring_list never change owner: they all live in one array owned by the ring_list
+        // and are linked in a circle once, on construction. That is why _next is a plain pointer here.
+        template<typename _T>
+        struct ring_list_node_t {
+            template<typename T> friend
+            class ::saxion::ring_list;
+
+            _T _value;
+            ring_list_node_t* _next;
+
+            ring_list_node_t(const ring_list_node_t&) = delete;
+
+            ring_list_node_t& operator=(const ring_list_node_t&) = delete;
+
+            ring_list_node_t():
+                    _value(),
+                    _next(nullptr){
+            }
+
+            _T& value() {
+                return _value;
+            }
+
+            _T const& value() const {
+                return _value;
+            }
+
+            [[nodiscard]]
+            ring_list_node_t* next() const noexcept{
+                return _next;
+            }
+        };
+
+        // in a full ring the last node links back to the first one, so a node pointer alone
+        // cannot tell begin() from end(). The iterators also carry the number of elements left to visit.
+        template<typename _T, typename _Nd = ring_list_node_t<_T>>
+        class ring_list_iterator {
+        public:
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+            using pointer = _T*;
+            using reference = _T&;
+            using value_type = _T;
+
+        private:
+            template<typename> friend
+            class ::saxion::ring_list;
+
+            friend
+            class ::saxion::detail::const_ring_list_iterator<_T, _Nd>;
+
+            using node_t = _Nd;
+
+            node_t* _current;
+            std::size_t _remaining;
+
+        public:
+            ring_list_iterator(node_t* element, std::size_t remaining) noexcept:
+                    _current(element),
+                    _remaining(remaining) {}
+
+            explicit ring_list_iterator(const const_ring_list_iterator<_T, _Nd>& iter) noexcept:
+                    _current(const_cast<node_t*>(iter._current)),
+                    _remaining(iter._remaining) {
+            }
+
+            reference operator*() const {
+                return _current->value();
+            }
+
+            [[nodiscard]]
+            pointer operator->() const {
+                return std::addressof(_current->value());
+            }
+
+            ring_list_iterator& operator++() {
+                _current = _current->_next;
+                --_remaining;
+                return *this;
+            }
+
+            ring_list_iterator operator++(int) {
+                ring_list_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+
+            [[nodiscard]]
+            bool operator==(const ring_list_iterator& other) const {
+                return _current == other._current && _remaining == other._remaining;
+            }
+
+            [[nodiscard]]
+            bool operator!=(const ring_list_iterator& other) const {
+                return !(*this == other);
+            }
+        };
+
+        template<typename _T, typename _Nd = ring_list_node_t<_T>>
+        class const_ring_list_iterator {
+        public:
+            using difference_type = std::ptrdiff_t;
+            using iterator_category = std::forward_iterator_tag;
+            using pointer = const _T*;
+            using reference = const _T&;
+            using value_type = _T;
+
+        private:
+            template<typename> friend
+            class ::saxion::ring_list;
+
+            friend
+            class ::saxion::detail::ring_list_iterator<_T, _Nd>;
+
+            using node_t = _Nd;
+
+            const node_t* _current;
+            std::size_t _remaining;
+
+        public:
+            const_ring_list_iterator(const node_t* element, std::size_t remaining) noexcept:
+                    _current(element),
+                    _remaining(remaining) {}
+
+            // implicit on purpose: a mutable iterator can always be used where a constant one is expected
+            const_ring_list_iterator(const ring_list_iterator<_T, _Nd>& iter) noexcept: // NOLINT
+                    _current(iter._current),
+                    _remaining(iter._remaining) {
+            }
+
+            [[nodiscard]]
+            reference operator*() const {
+                return _current->value();
+            }
+
+            [[nodiscard]]
+            pointer operator->() const {
+                return std::addressof(_current->value());
+            }
+
+            const_ring_list_iterator& operator++() {
+                _current = _current->_next;
+                --_remaining;
+                return *this;
+            }
+
+            const_ring_list_iterator operator++(int) {
+                const_ring_list_iterator tmp(*this);
+                ++(*this);
+                return tmp;
+            }
+
+            [[nodiscard]]
+            bool operator==(const const_ring_list_iterator& other) const {
+                return _current == other._current && _remaining == other._remaining;
+            }
+
+            [[nodiscard]]
+            bool operator!=(const const_ring_list_iterator& other) const {
+                return !(*this == other);
+            }
+        };
+    }
+
+
+    // a bounded singly-linked list for log tails and similar "keep the last N" workloads
+    // all the nodes are allocated up-front and linked in a circle. Once the list is full,
+    // push_back overwrites the oldest value in place and advances the head, so after
+    // construction no node is ever allocated or freed.
+    // iteration goes from the oldest to the newest element.
+    template<typename _T>
+    class ring_list {
+    public:
+        using value_type = _T;
+        using reference = _T&;
+        using const_reference = _T const&;
+        using pointer = _T*;
+        using const_pointer = _T const*;
+        using size_type = std::size_t;
+
+    private:
+
+        using node_t = detail::ring_list_node_t<_T>;
+
+        std::unique_ptr<node_t[]> _nodes;
+        node_t* _head;  // the oldest element
+        node_t* _tail;  // the newest element, _tail->_next is where the next push_back goes
+        size_type _size;
+        size_type _capacity;
+
+    public:
+
+        using iterator = detail::ring_list_iterator<_T, node_t>;
+        using const_iterator = detail::const_ring_list_iterator<_T, node_t>;
+
+        explicit ring_list(size_type capacity) :
+                _nodes{nullptr},
+                _head{nullptr},
+                _tail{nullptr},
+                _size{0},
+                _capacity{capacity} {
+            if (capacity == 0) {
+                throw std::length_error("ring_list capacity must be positive");
+            }
+            _nodes = std::make_unique<node_t[]>(capacity);
+            for (size_type i = 0; i + 1 < capacity; ++i) {
+                _nodes[i]._next = &_nodes[i + 1];
+            }
+            // close the circle
+            _nodes[capacity - 1]._next = &_nodes[0];
+            _head = &_nodes[0];
+            _tail = &_nodes[capacity - 1];
+        }
+
+        // copy ctor
+        ring_list(const ring_list& other) :
+                ring_list(other._capacity) {
+            for (auto& value : other) {
+                push_back(value);
+            }
+        }
+
+        // copy assignment operator
+        ring_list& operator=(const ring_list& other) {
+            if (this != &other) {
+                ring_list copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        // move ctor - the moved from ring keeps no nodes and must not be used except for assignment
+        ring_list(ring_list&& other) noexcept :
+                _nodes{std::move(other._nodes)},
+                _head{other._head},
+                _tail{other._tail},
+                _size{other._size},
+                _capacity{other._capacity} {
+            other._head = other._tail = nullptr;
+            other._size = other._capacity = 0;
+        }
+
+        // move assignment operator
+        ring_list& operator=(ring_list&& other) noexcept {
+            if (this != &other) {
+                swap(other);
+            }
+            return *this;
+        }
+
+        void swap(ring_list& other) noexcept {
+            std::swap(_nodes, other._nodes);
+            std::swap(_head, other._head);
+            std::swap(_tail, other._tail);
+            std::swap(_size, other._size);
+            std::swap(_capacity, other._capacity);
+        }
+
+        [[nodiscard]]
+        iterator begin() noexcept {
+            return iterator(_head, _size);
+        }
+
+        [[nodiscard]]
+        iterator end() noexcept {
+            return iterator(_tail ? _tail->_next : nullptr, 0);
+        }
+
+        [[nodiscard]]
+        const_iterator begin() const noexcept {
+            return const_iterator(_head, _size);
+        }
+
+        [[nodiscard]]
+        const_iterator end() const noexcept {
+            return const_iterator(_tail ? _tail->_next : nullptr, 0);
+        }
+
+        [[nodiscard]]
+        const_iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        [[nodiscard]]
+        const_iterator cend() const noexcept {
+            return end();
+        }
+
+        // accessors
+        [[nodiscard]]
+        reference front() {
+            return _head->value();
+        }
+
+        [[nodiscard]]
+        const_reference front() const {
+            return _head->value();
+        }
+
+        [[nodiscard]]
+        reference back() {
+            return _tail->value();
+        }
+
+        [[nodiscard]]
+        const_reference back() const {
+            return _tail->value();
+        }
+
+        [[nodiscard]]
+        reference operator[](size_type index) {
+            node_t* current = _head;
+            while (index--) { current = current->next(); }
+            return current->value();
+        }
+
+        [[nodiscard]]
+        const_reference operator[](size_type index) const {
+            const node_t* current = _head;
+            while (index--) { current = current->next(); }
+            return current->value();
+        }
+
+        [[nodiscard]]
+        reference at(size_type index) {
+            if (index < _size) {
+                return (*this)[index];
+            }
+            throw std::length_error("index out of bounds");
+        }
+
+        [[nodiscard]]
+        const_reference at(size_type index) const {
+            if (index < _size) {
+                return (*this)[index];
+            }
+            throw std::length_error("index out of bounds");
+        }
+
+        [[nodiscard]]
+        bool empty() const {
+            return _size == 0;
+        }
+
+        [[nodiscard]]
+        bool full() const {
+            return _size == _capacity;
+        }
+
+        [[nodiscard]]
+        size_type size() const {
+            return _size;
+        }
+
+        [[nodiscard]]
+        size_type capacity() const {
+            return _capacity;
+        }
+
+        // modifiers
+
+        // the popped value is not destroyed, it stays in its node until push_back overwrites it
+        void pop_front() noexcept {
+            if (_size) {
+                _head = _head->_next;
+                --_size;
+            }
+        }
+
+        void clear() noexcept {
+            if (_tail) {
+                _head = _tail->_next;
+            }
+            _size = 0;
+        }
+
+        // the value is assigned into the next node before the ring takes it in: when the assignment throws,
+        // the size, the head and the tail stay as they were (on a full ring, the oldest element may then
+        // be left partly assigned, the way a throwing assignment leaves any object)
+        iterator push_back(_T&& value) {
+            _tail->_next->_value = std::move(value);
+            advance_tail();
+            return iterator(_tail, 1);
+        }
+
+        iterator push_back(const_reference value) {
+            _tail->_next->_value = value;
+            advance_tail();
+            return iterator(_tail, 1);
+        }
+
+        // the nodes are constructed up-front, so the new value is built and then move-assigned into the node
+        template<typename... Args>
+        iterator emplace_back(Args&& ... args) {
+            _tail->_next->_value = _T(std::forward<Args>(args)...);
+            advance_tail();
+            return iterator(_tail, 1);
+        }
+
+    private:
+
+        // moves the tail one node forward, dropping the oldest element if the ring is full
+        void advance_tail() noexcept {
+            _tail = _tail->_next;
+            if (_size == _capacity) {
+                _head = _head->_next;
+            } else {
+                ++_size;
+            }
+        }
+
+    };
+
+}
+
+namespace std{
+    template<typename _T>
+    inline void swap(saxion::ring_list<_T>& x, saxion::ring_list <_T>& y) noexcept {
+        x.swap(y);
+    }
+}
+
+#endif //INCLUDE_RING_LIST_H
@@ -0,0 +1,87 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef INCLUDE_SIZE_POLICY_H
+#define INCLUDE_SIZE_POLICY_H
+
+#include <cstddef>
+
+namespace saxion {
+
+    // the size policies decide how a list keeps track of its number of elements
+    // they are passed as a template parameter: saxion::list<int, saxion::lazy_size>
+
+    // eager_size counts every change, so size() is always O(1)
+    // but moving a range of nodes between lists (splice, split_at) has to count the moved nodes
+    struct eager_size {
+        // the lists have to count ranges that change owner
+        static constexpr bool counts_ranges = true;
+
+        std::size_t _size = 0;
+
+        void add(std::size_t n) noexcept {
+            _size += n;
+        }
+
+        void subtract(std::size_t n) noexcept {
+            _size -= n;
+        }
+
+        void assign(std::size_t n) noexcept {
+            _size = n;
+        }
+
+        void invalidate() noexcept {
+        }
+
+        [[nodiscard]]
+        bool known() const noexcept {
+            return true;
+        }
+
+        [[nodiscard]]
+        std::size_t value() const noexcept {
+            return _size;
+        }
+    };
+
+    // lazy_size forgets the size when a range of unknown length is moved in or out, which keeps
+    // splice and split_at O(1). The next call to size() counts the nodes once and caches the result
+    struct lazy_size {
+        static constexpr bool counts_ranges = false;
+
+        std::size_t _size = 0;
+        bool _known = true;
+
+        // adding to or subtracting from an unknown size keeps it unknown
+        void add(std::size_t n) noexcept {
+            _size += n;
+        }
+
+        void subtract(std::size_t n) noexcept {
+            _size -= n;
+        }
+
+        void assign(std::size_t n) noexcept {
+            _size = n;
+            _known = true;
+        }
+
+        void invalidate() noexcept {
+            _known = false;
+        }
+
+        [[nodiscard]]
+        bool known() const noexcept {
+            return _known;
+        }
+
+        [[nodiscard]]
+        std::size_t value() const noexcept {
+            return _size;
+        }
+    };
+}
+
+#endif //INCLUDE_SIZE_POLICY_H
@@ -0,0 +1,135 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef INCLUDE_THREAD_POOL_H
+#define INCLUDE_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace saxion {
+
+    // a fixed set of threads for the parallel algorithms in parallel.h. run() hands out numbered
+    // tasks to the workers and to the calling thread and returns when all of them are done, a
+    // parallel algorithm is a few rounds of run() on one pool
+    class thread_pool {
+    public:
+        using size_type = std::size_t;
+
+        // threads counts the calling thread, the pool starts threads - 1 workers
+        explicit thread_pool(size_type threads) :
+                _workers{},
+                _mutex{},
+                _wake{},
+                _done{},
+                _job{},
+                _generation{0},
+                _busy{0},
+                _stop{false} {
+            for (size_type i = 1; i < threads; ++i) {
+                _workers.emplace_back([this]() { work(); });
+            }
+        }
+
+        thread_pool(const thread_pool&) = delete;
+
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        ~thread_pool() noexcept {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _wake.notify_all();
+            for (auto& worker : _workers) {
+                worker.join();
+            }
+        }
+
+        // the threads that run the tasks, the calling thread included
+        [[nodiscard]]
+        size_type size() const noexcept {
+            return _workers.size() + 1;
+        }
+
+        // calls task(i) for every i in [0, tasks), the tasks are picked up in order by whichever thread
+        // is free. Every task runs, also when another one threw; the first exception is rethrown after
+        template<typename _Task>
+        void run(size_type tasks, _Task&& task) {
+            std::atomic<size_type> next{0};
+            std::exception_ptr error;
+            std::mutex error_mutex;
+            std::function<void()> job = [&]() {
+                for (size_type i = next.fetch_add(1); i < tasks; i = next.fetch_add(1)) {
+                    try {
+                        task(i);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (!error) {
+                            error = std::current_exception();
+                        }
+                    }
+                }
+            };
+            if (!_workers.empty() && tasks > 1) {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _job = &job;
+                    _busy = _workers.size();
+                    ++_generation;
+                }
+                _wake.notify_all();
+                job();
+                std::unique_lock<std::mutex> lock(_mutex);
+                _done.wait(lock, [this]() { return _busy == 0; });
+                _job = nullptr;
+            } else {
+                job();
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+    private:
+        std::vector<std::thread> _workers;
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::condition_variable _done;
+        // the job of the current run(), every worker runs it once
+        std::function<void()>* _job;
+        size_type _generation;
+        size_type _busy;
+        bool _stop;
+
+        void work() {
+            size_type seen = 0;
+            while (true) {
+                std::function<void()>* job;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _wake.wait(lock, [this, seen]() { return _stop || _generation != seen; });
+                    if (_stop) {
+                        return;
+                    }
+                    seen = _generation;
+                    job = _job;
+                }
+                (*job)();
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (--_busy == 0) {
+                    _done.notify_one();
+                }
+            }
+        }
+    };
+}
+
+#endif //INCLUDE_THREAD_POOL_H
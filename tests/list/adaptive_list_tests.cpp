@@ -0,0 +1,212 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+#include <list>
+#include <algorithm>
+#include <stdexcept>
+
+#include "adaptive_list.h"
+
+namespace {
+    static auto names = {"alice", "bob", "cindy", "eve", "felix", "gina", "harold", "ilse", "jack"};
+
+    using mode = saxion::adaptive_mode;
+
+    TEST(adaptive_list_constructors, default_and_initializer_list) {
+        saxion::adaptive_list<int> empty;
+        ASSERT_TRUE(empty.empty());
+        ASSERT_EQ(empty.begin(), empty.end());
+        ASSERT_EQ(empty.mode(), mode::contiguous) << "A new adaptive_list should start out contiguous";
+
+        saxion::adaptive_list lst(names);
+        ASSERT_TRUE((std::is_same_v<std::string, decltype(lst)::value_type>));
+        ASSERT_EQ(lst.size(), names.size());
+        ASSERT_TRUE(std::equal(lst.begin(), lst.end(), names.begin(), names.end()));
+
+        auto copy(lst);
+        auto moved(std::move(lst));
+        ASSERT_EQ(copy.size(), names.size());
+        ASSERT_EQ(moved.size(), names.size());
+        ASSERT_EQ(moved.at(3), "eve");
+        ASSERT_ANY_THROW((void) moved.at(moved.size())) << "Accessing an element beyond the size should throw.";
+    }
+
+    TEST(adaptive_list_modes, middle_inserts_migrate_to_linked) {
+        saxion::adaptive_list<int> lst;
+        std::list<int> expected;
+        for (int i = 0; i < 1000; ++i) {
+            lst.push_back(i);
+            expected.push_back(i);
+        }
+        ASSERT_EQ(lst.mode(), mode::contiguous) << "Appends should keep the list contiguous";
+
+        auto pos = lst.begin();
+        auto expected_pos = expected.begin();
+        for (int i = 0; i < 500; ++i) ++pos, ++expected_pos;
+        for (int i = 0; i < 2 * static_cast<int>(lst.adapt_window); ++i) {
+            pos = lst.insert(pos, -i);
+            expected_pos = expected.insert(expected_pos, -i);
+        }
+        ASSERT_EQ(lst.mode(), mode::linked) << "Inserting in the middle should switch to the linked representation";
+        auto stats = lst.stats();
+        ASSERT_EQ(stats.mode, mode::linked);
+        ASSERT_EQ(stats.migrations, 1);
+        ASSERT_EQ(stats.middle_edits, 2 * lst.adapt_window);
+        ASSERT_EQ(stats.appends, 1000);
+        ASSERT_EQ(lst.size(), expected.size());
+        ASSERT_TRUE(std::equal(lst.begin(), lst.end(), expected.begin(), expected.end()))
+                                    << "A migration should keep the elements and their order";
+    }
+
+    TEST(adaptive_list_modes, reads_migrate_back_to_contiguous) {
+        saxion::adaptive_list<int> lst;
+        for (int i = 0; i < 200; ++i) lst.push_back(i);
+        for (int i = 0; i < 500; ++i) lst.push_front(-i);
+        ASSERT_EQ(lst.mode(), mode::linked);
+
+        long sum = 0;
+        // enough reads to outweigh the front inserts that are still in the current window
+        for (std::size_t i = 0; i < lst.adapt_window * lst.contiguous_ratio; ++i) {
+            sum += lst[i % lst.size()];
+        }
+        ASSERT_EQ(lst.mode(), mode::linked) << "Reads alone should never migrate";
+        lst.push_back(1000);
+        ASSERT_EQ(lst.mode(), mode::contiguous) << "The next insertion should act on a read-mostly window";
+        ASSERT_EQ(lst.stats().migrations, 2);
+        ASSERT_GE(lst.stats().indexed_reads, lst.adapt_window);
+        ASSERT_EQ(lst.front(), -499);
+        ASSERT_EQ(lst[499], 0);
+        ASSERT_EQ(lst.back(), 1000);
+        ASSERT_NE(sum, 0);
+    }
+
+    TEST(adaptive_list_modes, small_lists_stay_contiguous) {
+        saxion::adaptive_list<int> lst{1, 2, 3};
+        for (std::size_t i = 0; i < 4 * lst.adapt_window; ++i) {
+            lst.insert(++lst.begin(), static_cast<int>(i));
+            lst.erase(++lst.begin());
+        }
+        ASSERT_EQ(lst.mode(), mode::contiguous) << "Moving a few elements is cheaper than following links";
+        std::vector<int> expected{1, 2, 3};
+        ASSERT_TRUE(std::equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+
+        lst.reset_stats();
+        ASSERT_EQ(lst.stats().middle_edits, 0);
+        ASSERT_EQ(lst.stats().mode, mode::contiguous);
+    }
+
+    TEST(adaptive_list_modifiers, same_behaviour_in_both_modes) {
+        saxion::adaptive_list<std::string> lst(names);
+        for (int round = 0; round < 2; ++round) {
+            lst.push_front("zack");
+            lst.push_back("yara");
+            auto pos = lst.erase(++lst.begin());
+            ASSERT_EQ(*pos, "bob");
+            pos = lst.emplace(pos, 3, 'x');
+            ASSERT_EQ(*pos, "xxx");
+            ASSERT_EQ(lst[1], "xxx");
+            lst.pop_front();
+            lst.pop_back();
+            ASSERT_EQ(lst.front(), "xxx");
+            ASSERT_EQ(lst.back(), "jack");
+            lst.erase(lst.begin());
+            lst.push_front("alice");
+            ASSERT_TRUE(std::equal(lst.begin(), lst.end(), names.begin(), names.end()));
+
+            // grow the list and hammer its middle for the second round
+            for (int i = 0; i < 200; ++i) lst.push_back("filler");
+            for (std::size_t i = 0; i < lst.adapt_window; ++i) {
+                lst.erase(lst.insert(++lst.begin(), "temp"));
+            }
+            ASSERT_EQ(lst.mode(), mode::linked);
+            for (int i = 0; i < 200; ++i) lst.pop_back();
+        }
+    }
+
+    // copies throw while failing is set; the move may throw as well, so a migration copies
+    struct brittle {
+        static inline bool failing = false;
+        int value = 0;
+
+        // the sentinel node of the list needs one
+        brittle() = default;
+
+        brittle(int v) : value(v) {} // NOLINT
+
+        brittle(const brittle& other) : value(other.value) {
+            if (failing) throw std::runtime_error("copy failed");
+        }
+
+        brittle(brittle&& other) : value(other.value) {} // NOLINT: not noexcept on purpose
+
+        brittle& operator=(const brittle&) = default;
+
+        brittle& operator=(brittle&&) = default;
+
+        bool operator==(const brittle& other) const {
+            return value == other.value;
+        }
+    };
+
+    TEST(adaptive_list_modes, failed_migration_keeps_the_elements) {
+        saxion::adaptive_list<brittle> lst;
+        std::vector<brittle> expected;
+        for (int i = 0; i < 200; ++i) {
+            lst.push_back(brittle(i));
+            expected.emplace_back(i);
+        }
+        // a window of middle edits that is not full yet
+        for (int i = 0; i < 50; ++i) {
+            lst.insert(++lst.begin(), brittle(-1));
+            lst.erase(++lst.begin());
+        }
+        ASSERT_EQ(lst.mode(), mode::contiguous);
+        brittle::failing = true;
+        ASSERT_THROW(lst.adapt(), std::runtime_error);
+        brittle::failing = false;
+        ASSERT_EQ(lst.mode(), mode::contiguous) << "A failed migration should keep the old representation";
+        ASSERT_TRUE(std::equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+        ASSERT_TRUE(lst.adapt());
+        ASSERT_EQ(lst.mode(), mode::linked);
+        ASSERT_TRUE(std::equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+
+        // and back: a window of reads only
+        for (std::size_t i = 0; i < 100; ++i) (void) lst[i];
+        brittle::failing = true;
+        ASSERT_THROW(lst.adapt(), std::runtime_error);
+        brittle::failing = false;
+        ASSERT_EQ(lst.mode(), mode::linked);
+        ASSERT_EQ(lst.size(), expected.size());
+        ASSERT_TRUE(std::equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+        ASSERT_TRUE(lst.adapt());
+        ASSERT_EQ(lst.mode(), mode::contiguous);
+        ASSERT_TRUE(std::equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+    }
+
+    TEST(adaptive_list_modes, inserting_an_element_of_the_list_across_a_migration) {
+        saxion::adaptive_list<std::string> lst;
+        for (int i = 0; i < 300; ++i) lst.push_back(std::string(40, static_cast<char>('a' + i % 26)));
+        std::size_t migrations = lst.stats().migrations;
+        for (std::size_t i = 0; i < 2 * lst.adapt_window; ++i) {
+            auto pos = ++lst.begin();
+            auto inserted = lst.insert(pos, *pos);
+            ASSERT_EQ(*inserted, std::string(40, 'b')) << "Copy " << i << " of an element of the list";
+        }
+        ASSERT_GT(lst.stats().migrations, migrations) << "The inserts should cross a migration";
+        ASSERT_EQ(lst.mode(), mode::linked);
+
+        // enough reads to outweigh the inserts that are still in the window, the next append migrates back
+        migrations = lst.stats().migrations;
+        for (std::size_t i = 0; i < lst.adapt_window * lst.contiguous_ratio; ++i) (void) lst[i % lst.size()];
+        const std::string& first = lst.front();
+        auto appended = lst.push_back(first);
+        ASSERT_GT(lst.stats().migrations, migrations);
+        ASSERT_EQ(lst.mode(), mode::contiguous);
+        ASSERT_EQ(*appended, std::string(40, 'a'));
+        ASSERT_EQ(lst.back(), std::string(40, 'a'));
+    }
+}
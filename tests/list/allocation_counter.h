@@ -0,0 +1,43 @@
+//
+// Created by Saxion ACS.
+//
+
+#ifndef TESTS_ALLOCATION_COUNTER_H
+#define TESTS_ALLOCATION_COUNTER_H
+
+#include <cstdlib>
+#include <new>
+
+// replaces the global operator new and delete of the test executable that includes it,
+// so a test can check how often a container allocates. Include it in one source file only
+namespace allocation_counter {
+    inline std::size_t allocations = 0;
+}
+
+void* operator new(std::size_t size) {
+    ++allocation_counter::allocations;
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+// std::get_temporary_buffer (std::stable_sort) allocates with the nothrow form
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    ++allocation_counter::allocations;
+    return std::malloc(size ? size : 1);
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept {
+    std::free(memory);
+}
+
+#endif //TESTS_ALLOCATION_COUNTER_H
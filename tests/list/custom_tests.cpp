@@ -7,16 +7,6 @@
 #include "list.h"
 #include "forward_list.h"
 
-int main(int argc, char** argv) {
-
-
-    ::testing::InitGoogleTest(&argc, argv);
-
-//    ::testing::UnitTest& unit_test = *::testing::UnitTest::GetInstance();
-
-    auto ret_val = RUN_ALL_TESTS();
-}
-
 TEST(custom, always_pass) {
     ASSERT_TRUE(1 + 1 == 2) << "This test must always pass";
 }
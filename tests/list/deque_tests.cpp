@@ -0,0 +1,164 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <deque>
+#include <stdexcept>
+
+#include "deque.h"
+
+namespace {
+    static auto names = {"alice", "bob", "cindy", "eve", "felix", "gina", "harold", "ilse", "jack"};
+
+    TEST(deque_constructors, default_ctor) {
+        saxion::deque<int> dq;
+        ASSERT_EQ(dq.size(), 0) << "Default constructor should initialize a deque with 0 elements.";
+        ASSERT_TRUE(dq.empty()) << "A default constructed deque should be empty";
+        ASSERT_EQ(dq.begin(), dq.end());
+    }
+
+    TEST(deque_constructors, initializer_list_copy_move) {
+        saxion::deque dq(names);
+        ASSERT_TRUE((std::is_same_v<std::string, decltype(dq)::value_type>));
+        ASSERT_EQ(dq.size(), names.size());
+
+        auto copy(dq);
+        ASSERT_EQ(copy.size(), names.size());
+        auto moved(std::move(copy));
+        ASSERT_EQ(moved.size(), names.size());
+        ASSERT_EQ(copy.size(), 0);
+
+        auto name = names.begin();
+        for (std::size_t i = 0; i < names.size(); ++i, ++name) {
+            ASSERT_EQ(moved[i], *name) << "unexpected item at index: " << i;
+            ASSERT_EQ(dq.at(i), *name) << "unexpected item at index: " << i;
+        }
+        ASSERT_ANY_THROW((void) dq.at(dq.size())) << "Accessing deque element beyond its size should throw.";
+    }
+
+    TEST(deque_modifiers, push_pop_both_ends) {
+        // mirror every operation on a std::deque, crossing many chunk boundaries in both directions
+        saxion::deque<int> dq;
+        std::deque<int> expected;
+        const int count = 5 * static_cast<int>(saxion::deque<int>::chunk_size);
+
+        for (int i = 0; i < count; ++i) {
+            dq.push_back(i);
+            expected.push_back(i);
+            dq.push_front(-i);
+            expected.push_front(-i);
+        }
+        ASSERT_EQ(dq.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); i += 97) {
+            ASSERT_EQ(dq[i], expected[i]) << "unexpected item at index: " << i;
+        }
+
+        for (int i = 0; i < count; ++i) {
+            ASSERT_EQ(dq.front(), expected.front());
+            ASSERT_EQ(dq.back(), expected.back());
+            if (i % 3) {
+                dq.pop_front();
+                expected.pop_front();
+            } else {
+                dq.pop_back();
+                expected.pop_back();
+            }
+        }
+        ASSERT_EQ(dq.size(), expected.size());
+        ASSERT_TRUE(std::equal(dq.begin(), dq.end(), expected.begin()));
+
+        dq.clear();
+        ASSERT_TRUE(dq.empty());
+        dq.emplace_front(7);
+        ASSERT_EQ(dq.front(), 7);
+        ASSERT_EQ(dq.back(), 7);
+    }
+
+    TEST(deque_modifiers, fifo) {
+        saxion::deque<std::string> dq;
+        int popped = 0;
+        for (int i = 0; i < 10'000; ++i) {
+            dq.emplace_back(std::to_string(i));
+            if (i % 4 == 3) {
+                ASSERT_EQ(dq.front(), std::to_string(popped)) << "A deque used as a queue should preserve the order";
+                dq.pop_front();
+                ++popped;
+            }
+        }
+        ASSERT_EQ(dq.size(), 10'000u - popped);
+    }
+
+    // its constructor throws for negative values
+    struct picky {
+        int value;
+
+        explicit picky(int v) : value(v) {
+            if (v < 0) throw std::runtime_error("negative");
+        }
+    };
+
+    TEST(deque_modifiers, throwing_emplace_gives_the_chunk_back) {
+        saxion::deque<picky> dq;
+        dq.emplace_back(1);
+        ASSERT_THROW(dq.emplace_front(-1), std::runtime_error);
+        dq.pop_back();
+        ASSERT_TRUE(dq.empty());
+
+        // fill the chunks up to their edges, so the next emplace on either end needs a new chunk
+        const int count = static_cast<int>(saxion::deque<picky>::chunk_size);
+        for (int i = 0; i < count; ++i) {
+            dq.emplace_front(i);
+        }
+        ASSERT_THROW(dq.emplace_front(-1), std::runtime_error);
+        ASSERT_THROW(dq.emplace_back(-1), std::runtime_error);
+        ASSERT_EQ(dq.size(), static_cast<std::size_t>(count));
+        ASSERT_EQ(dq.front().value, count - 1);
+        ASSERT_EQ(dq.back().value, 0);
+        dq.emplace_back(-0);
+        dq.emplace_front(count);
+        ASSERT_EQ(dq.front().value, count);
+        ASSERT_EQ(dq.size(), static_cast<std::size_t>(count + 2));
+        while (!dq.empty()) {
+            dq.pop_back();
+        }
+    }
+
+    TEST(deque_iterators, random_access) {
+        saxion::deque<int> dq;
+        for (int i = 0; i < 1000; ++i) dq.push_front(i);
+
+        ASSERT_TRUE((std::is_same_v<std::random_access_iterator_tag,
+                std::iterator_traits<decltype(dq)::iterator>::iterator_category>));
+
+        auto it = dq.begin();
+        ASSERT_EQ(dq.end() - it, 1000);
+        ASSERT_EQ(it[10], 989);
+        it += 500;
+        ASSERT_EQ(*it, 499);
+        ASSERT_EQ(*(it - 1), 500);
+        ASSERT_TRUE(dq.begin() < it);
+        ASSERT_EQ(it, dq.cbegin() + 500) << "It should be possible to compare const and non-const iterators";
+
+        std::sort(dq.begin(), dq.end());
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_EQ(dq[i], i) << "std::sort should work on the deque iterators";
+        }
+    }
+
+    TEST(deque_iterators, iterator_converts_to_const_iterator) {
+        saxion::deque<int> dq;
+        for (int i = 0; i < 10; ++i) dq.push_back(i);
+        saxion::deque<int>::const_iterator it = dq.begin();
+        ASSERT_EQ(*it, 0);
+        auto distance = [](saxion::deque<int>::const_iterator from, saxion::deque<int>::const_iterator to) {
+            return to - from;
+        };
+        ASSERT_EQ(distance(dq.begin(), dq.end()), 10);
+        ASSERT_TRUE(it == dq.begin());
+        ASSERT_TRUE(dq.begin() == it);
+    }
+}
@@ -3,10 +3,16 @@
 //
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <stdexcept>
 #include <vector>
 #include <string>
 
 #include "forward_list.h"
+#include "allocation_counter.h"
 
 namespace {
     static auto names = {"alice", "bob", "cindy", "eve", "felix", "gina", "harold", "ilse", "jack"};
@@ -122,6 +128,19 @@ namespace {
         }
     }
 
+    TEST(forward_list_specializations, member_swap_with_an_empty_list) {
+        saxion::forward_list<int> lst{1, 2, 3};
+        saxion::forward_list<int> oth;
+        lst.swap(oth);
+        ASSERT_TRUE(lst.empty());
+        lst.push_back(4);
+        oth.push_back(5);
+        ASSERT_EQ(lst.size(), 1);
+        ASSERT_EQ(lst.front(), 4);
+        ASSERT_EQ(oth.size(), 4);
+        ASSERT_EQ(oth.back(), 5);
+    }
+
     TEST(forward_list_specializations, swap) {
         saxion::forward_list lst(names);
         saxion::forward_list<decltype(lst)::value_type> oth;
@@ -173,6 +192,56 @@ namespace {
         ASSERT_ANY_THROW((void) empty.at(0)) << "Accessing 0-th element of an empty list should throw";
     }
 
+    // its copy throws while breaking is set, and so does the constructor that takes an int < 0
+    struct touchy {
+        static inline bool breaking = false;
+        int value = 0;
+
+        touchy() = default;
+
+        explicit touchy(int v) : value(v) {
+            if (v < 0) throw std::runtime_error("negative");
+        }
+
+        touchy(const touchy& other) : value(other.value) {
+            if (breaking) throw std::runtime_error("copy failed");
+        }
+
+        touchy& operator=(const touchy&) = default;
+    };
+
+    TEST(forward_list_modifiers, throwing_value_leaves_the_list) {
+        saxion::forward_list<touchy> lst;
+        lst.push_back(touchy(1));
+        lst.push_back(touchy(2));
+        const touchy three(3);
+        touchy::breaking = true;
+        ASSERT_THROW(lst.push_back(three), std::runtime_error);
+        ASSERT_THROW(lst.push_front(three), std::runtime_error);
+        ASSERT_THROW(lst.insert_after(lst.begin(), three), std::runtime_error);
+        ASSERT_THROW(lst.insert_after(lst.before_begin(), three), std::runtime_error);
+        touchy::breaking = false;
+        ASSERT_THROW(lst.emplace_back(-1), std::runtime_error);
+        ASSERT_THROW(lst.emplace_front(-1), std::runtime_error);
+        ASSERT_THROW(lst.emplace_after(lst.begin(), -1), std::runtime_error);
+        ASSERT_EQ(lst.size(), 2);
+        ASSERT_EQ(lst.front().value, 1);
+        ASSERT_EQ(lst.back().value, 2);
+
+        lst.push_back(three);
+        lst.emplace_front(0);
+        ASSERT_EQ(lst.back().value, 3);
+        std::vector<int> values;
+        for (const auto& t : lst) values.push_back(t.value);
+        ASSERT_EQ(values, (std::vector<int>{0, 1, 2, 3}));
+
+        saxion::forward_list<touchy> empty;
+        ASSERT_THROW(empty.emplace_back(-1), std::runtime_error);
+        ASSERT_TRUE(empty.empty());
+        empty.emplace_back(4);
+        ASSERT_EQ(empty.back().value, 4);
+    }
+
     TEST(forward_list_modifiers, push_back_cpy) {
         saxion::forward_list lst(names);
         auto size = lst.size();
@@ -461,4 +530,610 @@ TEST(forward_list_modifiers, erase_after) {
         ASSERT_TRUE(name.empty()) << "The moved from object should be empty";
 
     }
-}
\ No newline at end of file
+
+    template<typename _Policy>
+    void check_splice_after_and_split() {
+        saxion::forward_list<std::string, _Policy> lst, other;
+        for (auto name : names) lst.push_back(name);
+        other.push_back("kate");
+        other.push_back("lars");
+        auto before_first = lst.begin();
+        auto last = before_first;
+        for (int i = 0; i < 3; ++i) ++last;
+        // move bob, cindy and eve after kate
+        other.splice_after(other.begin(), lst, before_first, last);
+        ASSERT_EQ(lst.size(), names.size() - 3);
+        ASSERT_EQ(other.size(), 5);
+        std::vector<std::string> expected{"kate", "bob", "cindy", "eve", "lars"};
+        ASSERT_TRUE(std::equal(other.begin(), other.end(), expected.begin(), expected.end()));
+        ASSERT_EQ(lst[1], "felix") << "The source list should be closed over the moved range";
+
+        // moving the tail of a list to the end of another should update both tails
+        auto lst_last = lst.begin();
+        auto lst_before_last = lst.before_begin();
+        while (std::next(lst_last) != lst.end()) { ++lst_last; ++lst_before_last; }
+        auto other_last = other.begin();
+        for (int i = 0; i < 4; ++i) ++other_last;
+        other.splice_after(other_last, lst, lst_before_last, lst_last);
+        ASSERT_EQ(other.back(), "jack");
+        ASSERT_EQ(lst.back(), "ilse");
+        lst.push_back("zack");
+        other.push_back("yara");
+        ASSERT_EQ(lst[lst.size() - 1], "zack");
+        ASSERT_EQ(other[other.size() - 1], "yara");
+
+        auto rest = other.split_after(other.begin());
+        ASSERT_EQ(other.size(), 1);
+        ASSERT_EQ(other.back(), "kate");
+        ASSERT_EQ(rest.size(), 6);
+        ASSERT_EQ(rest.front(), "bob");
+        ASSERT_EQ(rest.back(), "yara");
+        rest.push_back("will");
+        ASSERT_EQ(rest[6], "will");
+        other.push_back("vera");
+        ASSERT_EQ(other[1], "vera");
+
+        auto everything = rest.split_after(rest.before_begin());
+        ASSERT_TRUE(rest.empty());
+        ASSERT_EQ(everything.size(), 7);
+
+        // the whole of everything after vera, the last element of other
+        other.splice_after(++other.begin(), everything);
+        ASSERT_TRUE(everything.empty());
+        ASSERT_EQ(other.size(), 9);
+        ASSERT_EQ(other[2], "bob");
+        ASSERT_EQ(other.back(), "will");
+        other.splice_after(other.before_begin(), everything);
+        ASSERT_EQ(other.size(), 9);
+        other.push_back("tom");
+        everything.push_back("sara");
+        ASSERT_EQ(other[9], "tom");
+        ASSERT_EQ(everything.front(), "sara");
+        ASSERT_EQ(everything.size(), 1);
+    }
+
+    TEST(forward_list_modifiers, splice_after_split_eager) {
+        check_splice_after_and_split<saxion::eager_size>();
+    }
+
+    TEST(forward_list_modifiers, splice_after_split_lazy) {
+        check_splice_after_and_split<saxion::lazy_size>();
+    }
+
+    TEST(forward_list_modifiers, tail_follows_insert_and_erase) {
+        saxion::forward_list<int> lst{1, 2};
+        auto pos = lst.insert_after(++lst.begin(), 3);
+        ASSERT_EQ(lst.back(), 3) << "Inserting after the last element should move the tail";
+        lst.erase_after(++lst.begin());
+        ASSERT_EQ(lst.back(), 2) << "Erasing the last element should move the tail back";
+        lst.push_back(4);
+        ASSERT_EQ(lst[2], 4);
+        (void) pos;
+    }
+
+    TEST(forward_list_memory, retained_nodes_are_reused) {
+        saxion::forward_list<int> lst;
+        lst.reserve(1000);
+        ASSERT_GE(lst.capacity(), 1000);
+        ASSERT_TRUE(lst.empty());
+
+        auto before = allocation_counter::allocations;
+        for (int frame = 0; frame < 10; ++frame) {
+            for (int i = 0; i < 1000; ++i) lst.push_back(i);
+            ASSERT_EQ(lst.size(), 1000);
+            ASSERT_EQ(lst.back(), 999);
+            lst.clear(saxion::clear_mode::retain);
+            ASSERT_TRUE(lst.empty());
+            ASSERT_EQ(lst.capacity(), 1000) << "clear_mode::retain should keep every node";
+        }
+        ASSERT_EQ(allocation_counter::allocations, before) << "Refilling retained nodes should not allocate";
+
+        for (int i = 0; i < 10; ++i) lst.push_front(i);
+        lst.clear();
+        ASSERT_EQ(lst.capacity(), 990) << "A plain clear should free the nodes, the reserve stays";
+        lst.shrink_to_fit();
+        ASSERT_EQ(lst.capacity(), 0);
+        lst.push_back(1);
+        ASSERT_EQ(allocation_counter::allocations, before + 1);
+    }
+
+    TEST(forward_list_memory, retained_nodes_destroy_values) {
+        auto value = std::make_shared<int>(42);
+        saxion::forward_list<std::shared_ptr<int>> lst;
+        for (int i = 0; i < 5; ++i) lst.push_back(value);
+        ASSERT_EQ(value.use_count(), 6);
+        lst.clear(saxion::clear_mode::retain);
+        ASSERT_EQ(value.use_count(), 1) << "A retained node should not keep its value alive";
+        lst.push_back(value);
+        ASSERT_EQ(*lst.front(), 42);
+
+        saxion::forward_list<std::shared_ptr<int>> other;
+        other.swap(lst);
+        ASSERT_EQ(other.capacity(), 5) << "swap should exchange the retained nodes as well";
+        ASSERT_EQ(lst.capacity(), 0);
+    }
+
+    // throws once copies_left copies have been made, counts the live instances (the sentinels too)
+    struct fragile {
+        static inline int live = 0;
+        static inline int copies_left = -1;
+        int value;
+
+        fragile(int v = 0) : value(v) { ++live; }
+
+        fragile(const fragile& other) : value(other.value) {
+            if (copies_left == 0) throw std::runtime_error("copy failed");
+            --copies_left;
+            ++live;
+        }
+
+        fragile(fragile&& other) noexcept : value(other.value) { ++live; }
+
+        ~fragile() { --live; }
+    };
+
+    TEST(forward_list_bulk, copy_builds_one_block) {
+        saxion::forward_list<int> original;
+        for (int i = 0; i < 1000; ++i) original.push_front(i);
+
+        auto before = allocation_counter::allocations;
+        saxion::forward_list<int> copy(original);
+        ASSERT_LE(allocation_counter::allocations - before, 3u) << "The copy should not allocate per node";
+        ASSERT_TRUE(std::equal(copy.begin(), copy.end(), original.begin(), original.end()));
+        ASSERT_EQ(copy.size(), 1000);
+        ASSERT_EQ(copy.back(), 0);
+
+        std::vector<int> values(500, 7);
+        before = allocation_counter::allocations;
+        saxion::forward_list<int> from_range(values.begin(), values.end());
+        ASSERT_LE(allocation_counter::allocations - before, 3u);
+        ASSERT_EQ(from_range.size(), 500);
+
+        saxion::forward_list<std::string> from_init{"a", "b", "c"};
+        ASSERT_EQ(from_init.back(), "c");
+        from_init = saxion::forward_list<std::string>{"d", "e"};
+        ASSERT_EQ(from_init.front(), "d");
+        copy = original;
+        ASSERT_EQ(copy.size(), 1000);
+    }
+
+    TEST(forward_list_bulk, block_nodes_can_be_edited) {
+        auto value = std::make_shared<int>(1);
+        std::vector<std::shared_ptr<int>> values(20, value);
+        saxion::forward_list<std::shared_ptr<int>> lst(values.begin(), values.end());
+        values.clear();
+        ASSERT_EQ(value.use_count(), 21);
+
+        lst.pop_front();
+        lst.erase_after(std::next(lst.begin(), 3));
+        lst.insert_after(std::next(lst.begin(), 5), value);
+        lst.push_back(value);
+        ASSERT_EQ(value.use_count(), 21);
+
+        // block nodes moved into another list outlive the list they came from
+        saxion::forward_list<std::shared_ptr<int>> other;
+        {
+            saxion::forward_list<std::shared_ptr<int>> source(lst);
+            other.splice_after(other.before_begin(), source, std::next(source.begin(), 2), std::next(source.begin(), 6));
+            saxion::forward_list<std::shared_ptr<int>> rest = source.split_after(std::next(source.begin(), 10));
+            other.splice_after(other.before_begin(), rest, rest.before_begin(), std::next(rest.begin(), 2));
+            source.clear(saxion::clear_mode::retain);
+            ASSERT_EQ(source.capacity(), 0) << "Nodes of a block can't be retained";
+        }
+        ASSERT_EQ(other.size(), 7);
+        ASSERT_EQ(value.use_count(), 28);
+        lst.clear();
+        other.clear();
+        ASSERT_EQ(value.use_count(), 1);
+    }
+
+    TEST(forward_list_bulk, failed_copy_leaks_nothing) {
+        {
+            saxion::forward_list<fragile> original{1, 2, 3, 4, 5};
+            int live = fragile::live;
+            fragile::copies_left = 3;
+            ASSERT_THROW(saxion::forward_list<fragile> copy(original), std::runtime_error);
+            fragile::copies_left = -1;
+            ASSERT_EQ(fragile::live, live) << "The copies made before the throw should be destroyed";
+        }
+        ASSERT_EQ(fragile::live, 0);
+    }
+
+    TEST(forward_list_range, insert_and_erase_ranges) {
+        saxion::forward_list<int> lst{1, 2, 3};
+        std::vector<int> values{10, 11, 12};
+        auto it = lst.insert_after(lst.begin(), values.begin(), values.end());
+        ASSERT_EQ(*it, 12) << "insert_after should return the last inserted element";
+        ASSERT_EQ(std::vector<int>(lst.begin(), lst.end()), (std::vector<int>{1, 10, 11, 12, 2, 3}));
+        ASSERT_EQ(lst.size(), 6);
+
+        lst.append_range(values);
+        lst.insert_after(lst.before_begin(), {7, 8});
+        ASSERT_EQ(lst.size(), 11);
+        ASSERT_EQ(lst.back(), 12) << "append_range should move the tail";
+        ASSERT_EQ(lst.front(), 7);
+
+        auto last = lst.erase_after(lst.begin(), std::next(lst.begin(), 5));
+        ASSERT_EQ(*last, 12);
+        ASSERT_EQ(std::vector<int>(lst.begin(), lst.end()), (std::vector<int>{7, 12, 2, 3, 10, 11, 12}));
+        lst.erase_after(std::next(lst.begin(), 3), lst.end());
+        ASSERT_EQ(lst.back(), 3) << "Erasing up to the end should move the tail";
+        lst.push_back(4);
+        lst.pop_front_n(2);
+        lst.pop_back_n(1);
+        ASSERT_EQ(std::vector<int>(lst.begin(), lst.end()), (std::vector<int>{2, 3}));
+        ASSERT_EQ(lst.back(), 3);
+        lst.pop_back_n(5);
+        ASSERT_TRUE(lst.empty());
+        lst.push_back(1);
+        ASSERT_EQ(lst.front(), 1);
+    }
+
+    TEST(forward_list_range, assign_reuses_nodes) {
+        saxion::forward_list<std::string> lst{"a", "b", "c", "d"};
+        std::vector<std::string> values{"w", "x", "y"};
+        auto before = allocation_counter::allocations;
+        lst.assign(values.begin(), values.end());
+        ASSERT_EQ(allocation_counter::allocations, before) << "A shorter assign should not allocate nodes";
+        ASSERT_EQ(std::vector<std::string>(lst.begin(), lst.end()), values);
+        ASSERT_EQ(lst.back(), "y");
+        lst.assign({"p", "q", "r", "s", "t"});
+        ASSERT_EQ(lst.size(), 5);
+        ASSERT_EQ(lst.back(), "t");
+    }
+
+    TEST(forward_list_range, failed_insert_leaves_the_list) {
+        saxion::forward_list<fragile> lst;
+        lst.push_back(fragile(1));
+        std::vector<fragile> values{fragile(2), fragile(3), fragile(4)};
+        int live = fragile::live;
+        fragile::copies_left = 2;
+        ASSERT_THROW(lst.insert_after(lst.begin(), values.begin(), values.end()), std::runtime_error);
+        fragile::copies_left = -1;
+        ASSERT_EQ(fragile::live, live);
+        ASSERT_EQ(lst.size(), 1);
+        ASSERT_EQ(lst.back().value, 1);
+    }
+
+    // counts how its instances come about
+    struct tally {
+        static inline int constructed = 0;
+        static inline int copied = 0;
+        static inline int moved = 0;
+
+        static void reset() { constructed = copied = moved = 0; }
+
+        int id;
+        std::string name;
+
+        tally() : id(0) { ++constructed; }
+
+        tally(int i, std::string n) : id(i), name(std::move(n)) { ++constructed; }
+
+        tally(const tally& other) : id(other.id), name(other.name) { ++copied; }
+
+        tally(tally&& other) noexcept : id(other.id), name(std::move(other.name)) { ++moved; }
+    };
+
+    // can only be constructed in its final place
+    struct pinned {
+        int value;
+
+        pinned() : value(0) {}
+
+        explicit pinned(int v) : value(v) {}
+
+        pinned(const pinned&) = delete;
+
+        pinned(pinned&&) = delete;
+    };
+
+    TEST(forward_list_emplace, constructs_once_in_place) {
+        saxion::forward_list<tally> lst;
+        tally::reset();
+        lst.emplace_back(1, "one");
+        lst.emplace_front(0, "zero");
+        lst.emplace_after(lst.begin(), 2, "two");
+        lst.emplace_back(3, "three");
+        ASSERT_EQ(tally::constructed, 4);
+        ASSERT_EQ(tally::copied, 0);
+        ASSERT_EQ(tally::moved, 0) << "emplace should not move a temporary into the node";
+
+        std::vector<int> ids;
+        for (const auto& t : lst) ids.push_back(t.id);
+        ASSERT_EQ(ids, (std::vector<int>{0, 2, 1, 3}));
+        ASSERT_EQ(lst.back().name, "three");
+    }
+
+    TEST(forward_list_emplace, immovable_values) {
+        saxion::forward_list<pinned> lst;
+        lst.emplace_front(1);
+        lst.emplace_back(2);
+        lst.emplace_front(0);
+        int expected = 0;
+        for (const auto& p : lst) ASSERT_EQ(p.value, expected++);
+        lst.pop_front();
+        ASSERT_EQ(lst.front().value, 1);
+        ASSERT_EQ(lst.back().value, 2);
+    }
+}
+
+namespace {
+    TEST(forward_list_teardown, reserved_nodes_are_dropped_and_reused) {
+        saxion::forward_list<int> lst;
+        lst.reserve(1000);
+        for (int i = 0; i < 1000; ++i) lst.push_back(i);
+        auto rest = lst.split_after(std::next(lst.begin(), 989));
+        lst.clear(saxion::clear_mode::retain);
+        ASSERT_TRUE(lst.empty());
+        ASSERT_EQ(lst.capacity(), 0) << "A block that rest holds nodes of can't be handed out again";
+
+        int expected = 990;
+        for (int v : rest) ASSERT_EQ(v, expected++);
+        rest.push_front(989);
+        rest.clear();
+        ASSERT_TRUE(rest.empty());
+
+        lst.reserve(100);
+        for (int i = 0; i < 100; ++i) lst.push_back(i);
+        lst.clear(saxion::clear_mode::retain);
+        auto before = allocation_counter::allocations;
+        for (int i = 0; i < 100; ++i) lst.push_back(i);
+        ASSERT_EQ(allocation_counter::allocations, before) << "Clearing a block should hand its nodes out again";
+        ASSERT_EQ(lst.back(), 99);
+    }
+
+    TEST(forward_list_teardown, values_with_a_destructor_are_destroyed) {
+        auto value = std::make_shared<int>(7);
+        saxion::forward_list<std::shared_ptr<int>> lst;
+        lst.reserve(10);
+        for (int i = 0; i < 10; ++i) lst.push_front(value);
+        lst.clear();
+        ASSERT_EQ(value.use_count(), 1) << "clear should still destroy the values";
+
+        std::vector<std::shared_ptr<int>> values(5, value);
+        saxion::forward_list<std::shared_ptr<int>> copied(values.begin(), values.end());
+        values.clear();
+        copied.push_back(value);
+        copied.clear();
+        ASSERT_EQ(value.use_count(), 1);
+    }
+
+    TEST(forward_list_teardown, clear_incremental) {
+        auto value = std::make_shared<int>(1);
+        saxion::forward_list<std::shared_ptr<int>> lst;
+        for (int i = 0; i < 1000; ++i) lst.push_front(value);
+        int calls = 1;
+        while (!lst.clear_incremental(300)) {
+            ++calls;
+            ASSERT_EQ(value.use_count(), 1 + 1000 - 300 * (calls - 1));
+        }
+        ASSERT_EQ(calls, 4);
+        ASSERT_TRUE(lst.empty());
+        ASSERT_EQ(value.use_count(), 1);
+        ASSERT_TRUE(lst.clear_incremental(10)) << "An empty list is done at once";
+
+        saxion::forward_list<int> ints;
+        ints.reserve(100);
+        for (int i = 0; i < 100; ++i) ints.push_front(i);
+        ASSERT_TRUE(ints.clear_incremental(1)) << "A block of ints is dropped as a whole";
+    }
+
+    TEST(forward_list_teardown, detach_and_reclaim) {
+        auto value = std::make_shared<int>(1);
+        saxion::forward_list<std::shared_ptr<int>> lst;
+        for (int i = 0; i < 1000; ++i) lst.push_front(value);
+        lst.detach_and_reclaim();
+        ASSERT_TRUE(lst.empty());
+        ASSERT_EQ(lst.size(), 0);
+        saxion::reclaimer::instance().flush();
+        ASSERT_EQ(value.use_count(), 1) << "The reclaimer should have destroyed the values";
+
+        lst.push_front(value);
+        lst.push_front(value);
+        ASSERT_EQ(lst.size(), 2);
+        ASSERT_EQ(*lst.front(), 1);
+        lst.detach_and_reclaim();
+        lst.detach_and_reclaim();
+        saxion::reclaimer::instance().flush();
+        ASSERT_EQ(value.use_count(), 1);
+    }
+}
+
+namespace {
+    template<typename _L>
+    std::vector<typename _L::value_type> values_of(const _L& lst) {
+        return std::vector<typename _L::value_type>(lst.begin(), lst.end());
+    }
+
+    TEST(forward_list_radix_sort, sorts_numbers) {
+        std::mt19937_64 gen(3);
+        std::vector<std::uint64_t> expected;
+        saxion::forward_list<std::uint64_t> lst;
+        for (int i = 0; i < 10000; ++i) {
+            expected.push_back(gen());
+            lst.push_back(expected.back());
+        }
+        const std::uint64_t* first = &lst.front();
+        saxion::radix_sort(lst, [](std::uint64_t v) { return v; });
+        std::sort(expected.begin(), expected.end());
+        ASSERT_EQ(values_of(lst), expected);
+        ASSERT_EQ(lst.size(), expected.size());
+        ASSERT_TRUE(std::find_if(lst.begin(), lst.end(), [first](const std::uint64_t& v) { return &v == first; }) != lst.end())
+                                    << "radix_sort should relink the nodes, not move the values";
+        lst.push_back(0);
+        ASSERT_EQ(lst.back(), 0) << "The tail should be the last node after sorting";
+    }
+
+    TEST(forward_list_radix_sort, stable_and_signed) {
+        using entry = std::pair<int, int>;
+        saxion::forward_list<entry> lst;
+        std::vector<entry> expected;
+        for (int i = 0; i < 2000; ++i) {
+            entry e{(i * 7919) % 601 - 300, i};
+            expected.push_back(e);
+            lst.push_back(e);
+        }
+        auto key = [](const entry& e) { return e.first; };
+        saxion::radix_sort(lst, key);
+        std::stable_sort(expected.begin(), expected.end(), [](const entry& a, const entry& b) { return a.first < b.first; });
+        ASSERT_EQ(values_of(lst), expected);
+
+        saxion::forward_list<int> same{5, 5, 5};
+        saxion::radix_sort(same, [](int v) { return v; });
+        ASSERT_EQ(values_of(same), (std::vector<int>{5, 5, 5}));
+        saxion::forward_list<int> empty;
+        saxion::radix_sort(empty, [](int v) { return v; });
+        ASSERT_TRUE(empty.empty());
+    }
+
+    TEST(forward_list_radix_sort, throwing_key_keeps_the_elements) {
+        saxion::forward_list<int> lst;
+        for (int i = 0; i < 1000; ++i) lst.push_back((i * 37) % 1000 + 1000);
+        int calls = 0;
+        auto key = [&calls](int v) {
+            if (++calls == 1500) throw std::runtime_error("no key");
+            return v;
+        };
+        ASSERT_THROW(saxion::radix_sort(lst, key), std::runtime_error);
+        std::vector<int> values = values_of(lst);
+        ASSERT_EQ(values.size(), 1000);
+        std::sort(values.begin(), values.end());
+        for (int i = 0; i < 1000; ++i) ASSERT_EQ(values[i], i + 1000);
+        lst.push_back(1);
+        ASSERT_EQ(lst.back(), 1);
+    }
+
+    TEST(forward_list_merge_k, merges_many_lists) {
+        std::mt19937 gen(5);
+        std::uniform_int_distribution<int> dist(0, 100000);
+        std::vector<saxion::forward_list<int>> lists(37);
+        std::vector<int> expected;
+        for (auto& lst : lists) {
+            std::vector<int> values(dist(gen) % 200);
+            for (auto& v : values) v = dist(gen);
+            std::sort(values.begin(), values.end());
+            for (int v : values) lst.push_back(v);
+        }
+        lists[3].clear();
+        for (const auto& lst : lists) expected.insert(expected.end(), lst.begin(), lst.end());
+        std::sort(expected.begin(), expected.end());
+
+        auto merged = saxion::merge_k(lists.begin(), lists.end());
+        ASSERT_EQ(values_of(merged), expected);
+        ASSERT_EQ(merged.size(), expected.size());
+        for (const auto& lst : lists) ASSERT_TRUE(lst.empty());
+        merged.push_back(1000001);
+        ASSERT_EQ(merged.back(), 1000001);
+        lists[0].push_back(1);
+        ASSERT_EQ(values_of(lists[0]), (std::vector<int>{1}));
+    }
+
+    TEST(forward_list_merge_k, stable_and_edge_cases) {
+        using entry = std::pair<int, int>;
+        auto by_key = [](const entry& a, const entry& b) { return a.first < b.first; };
+        std::vector<saxion::forward_list<entry>> lists(3);
+        lists[0].push_back(entry{1, 0});
+        lists[0].push_back(entry{2, 0});
+        lists[1].push_back(entry{1, 1});
+        lists[1].push_back(entry{3, 1});
+        lists[2].push_back(entry{0, 2});
+        lists[2].push_back(entry{1, 2});
+        auto merged = saxion::merge_k(lists.begin(), lists.end(), by_key);
+        ASSERT_EQ(values_of(merged), (std::vector<entry>{{0, 2}, {1, 0}, {1, 1}, {1, 2}, {2, 0}, {3, 1}}));
+
+        std::vector<saxion::forward_list<int>> none;
+        ASSERT_TRUE(saxion::merge_k(none.begin(), none.end()).empty());
+        std::vector<saxion::forward_list<int>> one(1);
+        one[0].push_back(4);
+        one[0].push_back(5);
+        auto single = saxion::merge_k(one.begin(), one.end());
+        ASSERT_EQ(values_of(single), (std::vector<int>{4, 5}));
+        ASSERT_TRUE(one[0].empty());
+    }
+
+    TEST(forward_list_merge_k, throwing_comparator) {
+        std::vector<saxion::forward_list<int>> lists(5);
+        for (std::size_t l = 1; l < lists.size(); ++l) {
+            for (int i = 0; i < 10; ++i) lists[l].push_back(i * 4 + static_cast<int>(l));
+        }
+        int calls = 0;
+        auto throwing = [&calls](int a, int b) {
+            if (++calls == 20) throw std::runtime_error("comparison failed");
+            return a < b;
+        };
+        ASSERT_THROW(saxion::merge_k(lists.begin(), lists.end(), throwing), std::runtime_error);
+        ASSERT_TRUE(lists[0].empty()) << "An empty list should get nothing";
+        ASSERT_EQ(lists[1].size(), 40) << "The first list that had elements should get all of them back";
+        for (std::size_t l = 2; l < lists.size(); ++l) ASSERT_TRUE(lists[l].empty());
+        std::vector<int> values(lists[1].begin(), lists[1].end());
+        std::sort(values.begin(), values.end());
+        for (int i = 0; i < 40; ++i) ASSERT_EQ(values[i], i + 1);
+        lists[1].push_back(100);
+        ASSERT_EQ(lists[1].back(), 100);
+        lists[0].push_back(7);
+        ASSERT_EQ(lists[0].front(), 7);
+    }
+
+    TEST(forward_list_relink, remove_if_and_remove) {
+        auto value = std::make_shared<int>(0);
+        saxion::forward_list<std::shared_ptr<int>> shared;
+        for (int i = 0; i < 10; ++i) shared.push_back(i % 2 ? value : std::make_shared<int>(i));
+        ASSERT_EQ(shared.remove_if([&value](const std::shared_ptr<int>& p) { return p == value; }), 5);
+        ASSERT_EQ(value.use_count(), 1) << "The removed values should be destroyed";
+        ASSERT_EQ(shared.size(), 5);
+
+        saxion::forward_list<int> lst{1, 2, 3, 2, 4, 2};
+        ASSERT_EQ(lst.remove(lst.front() + 1), 3);
+        ASSERT_EQ(values_of(lst), (std::vector<int>{1, 3, 4}));
+        // value refers to an element that is removed itself
+        ASSERT_EQ(lst.remove(lst.front()), 1);
+        ASSERT_EQ(values_of(lst), (std::vector<int>{3, 4}));
+        ASSERT_EQ(lst.remove(7), 0);
+        ASSERT_EQ(lst.remove_if([](int) { return true; }), 2);
+        ASSERT_TRUE(lst.empty());
+        lst.push_back(5);
+        ASSERT_EQ(lst.back(), 5);
+    }
+
+    TEST(forward_list_relink, unique) {
+        saxion::forward_list<int> lst{1, 1, 2, 2, 2, 3, 1, 1};
+        ASSERT_EQ(lst.unique(), 4);
+        ASSERT_EQ(values_of(lst), (std::vector<int>{1, 2, 3, 1}));
+        ASSERT_EQ(lst.size(), 4);
+        saxion::forward_list<int> close{1, 2, 4, 5, 9};
+        ASSERT_EQ(close.unique([](int a, int b) { return b - a <= 1; }), 2);
+        ASSERT_EQ(values_of(close), (std::vector<int>{1, 4, 9}));
+        close.push_back(10);
+        ASSERT_EQ(close.back(), 10);
+    }
+
+    TEST(forward_list_relink, reverse_and_partition) {
+        saxion::forward_list<int> lst{1, 2, 3, 4, 5, 6, 7};
+        lst.reverse();
+        ASSERT_EQ(values_of(lst), (std::vector<int>{7, 6, 5, 4, 3, 2, 1}));
+        lst.push_back(0);
+        ASSERT_EQ(lst.back(), 0);
+        auto split = lst.stable_partition([](int v) { return v % 2 == 0; });
+        ASSERT_EQ(values_of(lst), (std::vector<int>{6, 4, 2, 0, 7, 5, 3, 1}));
+        ASSERT_EQ(*std::next(split), 7);
+        ASSERT_EQ(lst.size(), 8);
+        lst.push_back(9);
+        ASSERT_EQ(lst.back(), 9);
+        lst.partition([](int v) { return v > 100; });
+        ASSERT_EQ(lst.front(), 6);
+
+        int calls = 0;
+        auto throwing = [&calls](int v) {
+            if (++calls == 4) throw std::runtime_error("no answer");
+            return v % 2 == 1;
+        };
+        ASSERT_THROW(lst.stable_partition(throwing), std::runtime_error);
+        ASSERT_EQ(lst.size(), 9);
+        std::vector<int> values = values_of(lst);
+        std::sort(values.begin(), values.end());
+        ASSERT_EQ(values, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 9}));
+        lst.push_back(10);
+        ASSERT_EQ(lst.back(), 10);
+    }
+}
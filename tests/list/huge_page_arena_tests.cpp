@@ -0,0 +1,112 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "huge_page_arena.h"
+#include "list_nodes.h"
+
+namespace {
+
+    TEST(huge_page_arena, reuses_freed_slots) {
+        saxion::huge_page_arena arena(32, std::size_t{64} << 20u);
+        void* first = arena.allocate(32);
+        void* second = arena.allocate(32);
+        ASSERT_EQ(static_cast<char*>(second) - static_cast<char*>(first), 32) << "Slots should be handed out in order";
+        ASSERT_TRUE(arena.owns(first));
+        ASSERT_EQ(arena.used(), arena.slab_bytes()) << "A thread should take a whole slab at once";
+
+        arena.deallocate(first, 32);
+        ASSERT_EQ(arena.allocate(32), first) << "A freed slot should be reused";
+
+        // a block of slots is split up when it is freed
+        void* block = arena.allocate(4 * 32);
+        arena.deallocate(block, 4 * 32);
+        std::vector<void*> slots;
+        for (int i = 0; i < 4; ++i) slots.push_back(arena.allocate(32));
+        ASSERT_EQ(arena.used(), arena.slab_bytes() + 4 * 32) << "The slots of the block should be reused";
+        for (void* slot : slots) {
+            auto offset = static_cast<char*>(slot) - static_cast<char*>(block);
+            ASSERT_TRUE(offset >= 0 && offset < 4 * 32 && offset % 32 == 0);
+        }
+    }
+
+    TEST(huge_page_arena, falls_back_when_used_up) {
+        // the reservation is rounded up to a single huge page
+        saxion::huge_page_arena arena(64, 1);
+        std::vector<void*> slots;
+        for (std::size_t i = 0; i < saxion::huge_page_arena::huge_page_size / 64 + 10; ++i) {
+            slots.push_back(arena.allocate(64));
+        }
+        ASSERT_FALSE(arena.owns(slots.back())) << "The arena should fall back to the heap";
+        for (void* slot : slots) arena.deallocate(slot, 64);
+    }
+
+    TEST(huge_page_arena, threads_share_the_slots) {
+        saxion::huge_page_arena arena(32, std::size_t{64} << 20u);
+        constexpr std::size_t per_thread = 20000;
+        std::vector<std::vector<void*>> taken(4);
+        std::vector<std::thread> threads;
+        for (auto& slots : taken) {
+            threads.emplace_back([&arena, &slots]() {
+                for (std::size_t i = 0; i < per_thread; ++i) slots.push_back(arena.allocate(32));
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        std::vector<void*> all;
+        for (auto& slots : taken) all.insert(all.end(), slots.begin(), slots.end());
+        std::sort(all.begin(), all.end());
+        ASSERT_TRUE(std::adjacent_find(all.begin(), all.end()) == all.end()) << "No slot should be handed out twice";
+
+        // freed by other threads than the ones that took them; their caches go back when they end
+        threads.clear();
+        for (std::size_t t = 0; t < taken.size(); ++t) {
+            threads.emplace_back([&arena, &slots = taken[(t + 1) % taken.size()]]() {
+                for (void* slot : slots) arena.deallocate(slot, 32);
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        std::size_t used = arena.used();
+        std::vector<void*> again;
+        for (std::size_t i = 0; i < 4 * per_thread; ++i) again.push_back(arena.allocate(32));
+        ASSERT_EQ(arena.used(), used) << "The slots that the ended threads freed should be reused";
+        for (void* slot : again) arena.deallocate(slot, 32);
+    }
+
+    TEST(huge_page_arena, list_nodes) {
+        using node = saxion::huge_page_node<std::shared_ptr<int>>;
+        auto value = std::make_shared<int>(3);
+        {
+            saxion::list<std::shared_ptr<int>, saxion::eager_size, node> lst;
+            for (int i = 0; i < 1000; ++i) lst.push_back(value);
+            ASSERT_TRUE(saxion::huge_page_arena::of<node>().owns(&*lst.begin()));
+            lst.erase(std::next(lst.begin(), 10));
+            lst.clear(saxion::clear_mode::retain);
+            ASSERT_EQ(lst.capacity(), 999u);
+            for (int i = 0; i < 500; ++i) lst.push_front(value);
+            lst.shrink_to_fit();
+            lst.reserve(100);
+            lst.defragment();
+            ASSERT_TRUE(saxion::huge_page_arena::of<node>().owns(&*lst.begin()));
+            ASSERT_EQ(lst.size(), 500u);
+            ASSERT_EQ(value.use_count(), 501);
+        }
+        ASSERT_EQ(value.use_count(), 1);
+    }
+
+    TEST(huge_page_arena, forward_list_nodes) {
+        using node = saxion::forward_huge_page_node<int>;
+        saxion::forward_list<int, saxion::eager_size, node> lst;
+        for (int i = 0; i < 1000; ++i) lst.push_front(i);
+        ASSERT_TRUE(saxion::huge_page_arena::of<node>().owns(&lst.front()));
+        lst.clear(saxion::clear_mode::retain);
+        for (int i = 0; i < 1000; ++i) lst.push_front(i);
+        ASSERT_EQ(lst.front(), 999);
+        lst.clear();
+    }
+}
@@ -0,0 +1,107 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+#include <optional>
+
+#include "lazy_list.h"
+
+namespace {
+    static std::vector<std::string> names{"alice", "bob", "cindy", "eve", "felix", "gina", "harold", "ilse", "jack"};
+
+    // a generator over names that counts how often it was called
+    struct names_generator {
+        std::size_t* calls;
+        std::size_t next = 0;
+
+        std::optional<std::string> operator()() {
+            ++*calls;
+            if (next == names.size()) {
+                return std::nullopt;
+            }
+            return names[next++];
+        }
+    };
+
+    TEST(lazy_list_constructors, default_ctor) {
+        saxion::lazy_list<int> lst;
+        ASSERT_TRUE(lst.empty());
+        ASSERT_EQ(lst.size(), 0);
+        ASSERT_EQ(lst.begin(), lst.end());
+        ASSERT_TRUE(lst.exhausted());
+        ASSERT_ANY_THROW((void) lst.front()) << "front() of an empty lazy_list should throw";
+    }
+
+    TEST(lazy_list_materialization, front_materializes_one) {
+        std::size_t calls = 0;
+        saxion::lazy_list lst(names_generator{&calls});
+        ASSERT_TRUE((std::is_same_v<std::string, decltype(lst)::value_type>));
+        ASSERT_EQ(calls, 0) << "Constructing a lazy_list should not call the generator";
+        ASSERT_EQ(lst.front(), "alice");
+        ASSERT_EQ(calls, 1);
+        ASSERT_EQ(lst.materialized(), 1);
+        ASSERT_FALSE(lst.empty());
+        ASSERT_EQ(calls, 1) << "empty() should not materialize more than the first element";
+    }
+
+    TEST(lazy_list_materialization, iteration_is_cached) {
+        std::size_t calls = 0;
+        saxion::lazy_list lst(names_generator{&calls});
+        auto it = lst.begin();
+        ++it;
+        ++it;
+        ASSERT_EQ(*it, "cindy");
+        ASSERT_EQ(lst.materialized(), 3) << "Iteration should only materialize the elements it reaches";
+
+        std::size_t i = 0;
+        for (auto& name : lst) {
+            ASSERT_EQ(name, names[i++]);
+        }
+        ASSERT_EQ(i, names.size());
+        ASSERT_TRUE(lst.exhausted());
+        std::size_t after_first_pass = calls;
+        ASSERT_EQ(after_first_pass, names.size() + 1) << "The generator should be called once per element and once more";
+
+        i = 0;
+        for (auto& name : lst) {
+            ASSERT_EQ(name, names[i++]);
+        }
+        ASSERT_EQ(calls, after_first_pass) << "A second iteration should use the cached nodes";
+        ASSERT_EQ(lst.size(), names.size());
+    }
+
+    TEST(lazy_list_materialization, take) {
+        std::size_t calls = 0;
+        saxion::lazy_list lst(names_generator{&calls});
+        auto first = lst.take(4);
+        ASSERT_EQ(first.size(), 4);
+        ASSERT_EQ(first.front(), "alice");
+        ASSERT_EQ(first.back(), "eve");
+        ASSERT_EQ(lst.materialized(), 4);
+        ASSERT_FALSE(lst.exhausted());
+
+        auto all = lst.take(100);
+        ASSERT_EQ(all.size(), names.size()) << "take should stop at the end of the generator";
+        ASSERT_TRUE(lst.exhausted());
+    }
+
+    TEST(lazy_list_materialization, infinite_generator) {
+        int next = 0;
+        saxion::lazy_list<int> lst([&next]() -> std::optional<int> { return next++; });
+        auto it = lst.begin();
+        for (int i = 0; i < 1000; ++i, ++it) {
+            ASSERT_EQ(*it, i);
+        }
+        ASSERT_EQ(lst.materialized(), 1001);
+
+        auto moved(std::move(lst));
+        ASSERT_EQ(moved.front(), 0);
+        ASSERT_EQ(moved.take(5).back(), 4);
+        ASSERT_EQ(lst.materialized(), 0);
+        moved.clear();
+        ASSERT_TRUE(moved.empty()) << "clear should drop the generator as well";
+    }
+}
@@ -0,0 +1,111 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+#include "linked_hash_map.h"
+
+namespace {
+    static auto names = {"alice", "bob", "cindy", "eve", "felix", "gina", "harold", "ilse", "jack"};
+
+    TEST(linked_hash_map_constructors, default_ctor) {
+        saxion::linked_hash_map<std::string, int> map;
+        ASSERT_EQ(map.size(), 0);
+        ASSERT_TRUE(map.empty());
+        ASSERT_EQ(map.find("alice"), map.end()) << "Nothing can be found in an empty map";
+        ASSERT_EQ(map.erase("alice"), 0);
+    }
+
+    TEST(linked_hash_map_constructors, copy_move) {
+        saxion::linked_hash_map<std::string, int> map{{"alice", 1}, {"bob", 2}, {"cindy", 3}};
+        auto copy(map);
+        ASSERT_EQ(copy.size(), 3);
+        ASSERT_EQ(copy.at("bob"), 2);
+
+        auto moved(std::move(copy));
+        ASSERT_EQ(moved.size(), 3);
+        ASSERT_EQ(copy.size(), 0);
+        ASSERT_EQ(moved.front().first, "alice");
+        ASSERT_EQ(moved.back().first, "cindy");
+
+        copy = moved;
+        ASSERT_EQ(copy.size(), 3);
+        ASSERT_TRUE(copy.contains("cindy"));
+    }
+
+    TEST(linked_hash_map_modifiers, insertion_order) {
+        saxion::linked_hash_map<std::string, int> map;
+        int i = 0;
+        for (auto name : names) {
+            auto [pos, inserted] = map.insert({name, i++});
+            ASSERT_TRUE(inserted);
+            ASSERT_EQ(pos->first, name);
+        }
+        auto [pos, inserted] = map.insert({"alice", 42});
+        ASSERT_FALSE(inserted) << "A key can only be present once";
+        ASSERT_EQ(pos->second, 0) << "A failed insertion should not change the value";
+
+        auto name = names.begin();
+        for (auto& item : map) {
+            ASSERT_EQ(item.first, *name) << "Iteration should follow the insertion order";
+            ++name;
+        }
+    }
+
+    TEST(linked_hash_map_modifiers, erase_and_move_to_back) {
+        saxion::linked_hash_map<std::string, int> map;
+        int i = 0;
+        for (auto name : names) map[name] = i++;
+
+        ASSERT_EQ(map.erase("cindy"), 1);
+        ASSERT_EQ(map.erase("cindy"), 0);
+        ASSERT_FALSE(map.contains("cindy"));
+
+        map.move_to_back("alice");
+        ASSERT_EQ(map.back().first, "alice");
+        ASSERT_EQ(map.front().first, "bob");
+        ASSERT_EQ(map.move_to_back("nobody"), map.end());
+
+        auto pos = map.erase(map.find("eve"));
+        ASSERT_EQ(pos->first, "felix") << "erase should return the element after the erased one";
+
+        map.pop_front();
+        std::vector<std::string> expected{"felix", "gina", "harold", "ilse", "jack", "alice"};
+        ASSERT_EQ(map.size(), expected.size());
+        std::size_t index = 0;
+        for (auto& item : map) {
+            ASSERT_EQ(item.first, expected[index++]);
+        }
+        for (auto& key : expected) {
+            ASSERT_TRUE(map.contains(key)) << "Every remaining key should still be found: " << key;
+        }
+    }
+
+    TEST(linked_hash_map_modifiers, many_keys) {
+        // mirror a random mix of insertions and erasures on std::unordered_map
+        saxion::linked_hash_map<int, int> map;
+        std::unordered_map<int, int> expected;
+        unsigned state = 12345;
+        for (int i = 0; i < 50'000; ++i) {
+            state = state * 1103515245u + 12345u;
+            int key = static_cast<int>((state >> 8u) % 4096);
+            if (state & 1u) {
+                map[key] = i;
+                expected[key] = i;
+            } else {
+                ASSERT_EQ(map.erase(key), expected.erase(key));
+            }
+        }
+        ASSERT_EQ(map.size(), expected.size());
+        for (auto& [key, value] : expected) {
+            ASSERT_EQ(map.at(key), value);
+        }
+        map.clear();
+        ASSERT_TRUE(map.empty());
+        ASSERT_FALSE(map.contains(expected.begin()->first));
+    }
+}
@@ -0,0 +1,129 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+
+#include "list_nodes.h"
+
+namespace {
+    static auto names = {"alice", "bob", "cindy", "eve", "felix", "gina", "harold", "ilse", "jack"};
+
+    struct person {
+        int id;
+        std::string name;
+    };
+
+    struct by_id {
+        int operator()(const person& p) const noexcept {
+            return p.id;
+        }
+    };
+
+    // counts the hashes, so the tests can see that a node hashes its value only once
+    struct counting_hash {
+        static inline int calls = 0;
+
+        std::size_t operator()(const std::string& value) const {
+            ++calls;
+            return std::hash<std::string>{}(value);
+        }
+    };
+
+    TEST(list_nodes, plain_find) {
+        saxion::list<std::string> lst(names);
+        auto found = lst.find(std::string("eve"));
+        ASSERT_NE(found, lst.end());
+        ASSERT_EQ(*found, "eve");
+        ASSERT_EQ(lst.find(std::string("zack")), lst.end()) << "find should return end() for a missing value";
+
+        lst.reverse();
+        lst.push_front("eve");
+        ASSERT_EQ(lst.find(std::string("eve")), lst.begin()) << "find should return the first match in list order";
+
+        saxion::forward_list<std::string> flst;
+        for (auto name : names) flst.push_back(name);
+        ASSERT_EQ(*flst.find(std::string("gina")), "gina");
+        ASSERT_EQ(flst.find(std::string("zack")), flst.end());
+    }
+
+    TEST(list_nodes, cached_hash_node) {
+        using node = saxion::cached_hash_node<std::string, counting_hash>;
+        saxion::list<std::string, saxion::eager_size, node> lst;
+        for (auto name : names) lst.push_back(name);
+        int hashed = counting_hash::calls;
+
+        auto found = lst.find(std::string("harold"));
+        ASSERT_EQ(*found, "harold");
+        ASSERT_EQ(counting_hash::calls, hashed + 1) << "A lookup should hash the key once and reuse the cached hashes";
+        ASSERT_EQ(lst.find(std::string("zack")), lst.end());
+
+        // the node type should not get in the way of the other operations
+        lst.erase(found);
+        lst.emplace(lst.begin(), 3, 'z');
+        ASSERT_EQ(*lst.find(std::string("zzz")), "zzz");
+        auto other = lst.split_at(lst.find(std::string("eve")));
+        ASSERT_EQ(other.front(), "eve");
+        ASSERT_EQ(other.find(std::string("bob")), other.end());
+        auto copy(lst);
+        ASSERT_EQ(*copy.find(std::string("bob")), "bob");
+    }
+
+    TEST(list_nodes, key_node) {
+        saxion::list<person, saxion::eager_size, saxion::key_node<person, by_id>> lst;
+        int id = 0;
+        for (auto name : names) lst.push_back(person{id++, name});
+
+        auto found = lst.find(4);
+        ASSERT_NE(found, lst.end());
+        ASSERT_EQ(found->name, "felix") << "find should compare the projected key";
+        ASSERT_EQ(lst.find(42), lst.end());
+
+        const auto& clst = lst;
+        ASSERT_EQ(clst.find(0)->name, "alice");
+        lst.reverse();
+        ASSERT_EQ(lst.find(8), lst.begin());
+    }
+
+    TEST(list_nodes, forward_nodes) {
+        saxion::forward_list<person, saxion::eager_size, saxion::forward_key_node<person, by_id>> lst;
+        int id = 0;
+        for (auto name : names) lst.push_back(person{id++, name});
+        ASSERT_EQ(lst.find(2)->name, "cindy");
+        lst.erase_after(lst.find(1));
+        ASSERT_EQ(lst.find(2), lst.end());
+
+        saxion::forward_list<std::string, saxion::lazy_size, saxion::forward_cached_hash_node<std::string>> hashed;
+        for (auto name : names) hashed.push_front(name);
+        ASSERT_EQ(*hashed.find(std::string("bob")), "bob");
+        ASSERT_EQ(hashed.size(), names.size());
+    }
+
+    TEST(list_nodes, find_after_assign) {
+        saxion::list<std::string, saxion::eager_size, saxion::cached_hash_node<std::string>> hashed{"alpha", "beta", "gamma"};
+        hashed.assign({"x", "y", "z", "w"});
+        ASSERT_NE(hashed.find(std::string("y")), hashed.end()) << "assign should hash the reused nodes again";
+        ASSERT_EQ(hashed.find(std::string("beta")), hashed.end());
+        ASSERT_EQ(*hashed.find(std::string("w")), "w");
+
+        saxion::forward_list<std::string, saxion::eager_size, saxion::forward_cached_hash_node<std::string>> forward_hashed{
+                "alpha", "beta", "gamma"};
+        forward_hashed.assign({"x", "y"});
+        ASSERT_EQ(*forward_hashed.find(std::string("y")), "y");
+        ASSERT_EQ(forward_hashed.find(std::string("alpha")), forward_hashed.end());
+
+        saxion::list<person, saxion::eager_size, saxion::key_node<person, by_id>> keyed{person{1, "ann"}, person{2, "ben"}};
+        std::vector<person> people{{7, "cas"}, {8, "dia"}};
+        keyed.assign(people.begin(), people.end());
+        ASSERT_EQ(keyed.find(8)->name, "dia") << "assign should take the keys of the new values";
+        ASSERT_EQ(keyed.find(2), keyed.end());
+
+        saxion::forward_list<person, saxion::eager_size, saxion::forward_key_node<person, by_id>> forward_keyed{
+                person{1, "ann"}, person{2, "ben"}, person{3, "cor"}};
+        forward_keyed.assign(people.begin(), people.end());
+        ASSERT_EQ(forward_keyed.find(7)->name, "cas");
+        ASSERT_EQ(forward_keyed.find(1), forward_keyed.end());
+    }
+}
@@ -3,11 +3,18 @@
 //
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <random>
+#include <memory>
+#include <stdexcept>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 #include "list.h"
+#include "allocation_counter.h"
 
 namespace {
     static auto names = {"alice", "bob", "cindy", "eve", "felix", "gina", "harold", "ilse", "jack"};
@@ -136,7 +143,7 @@ namespace {
             list->emplace_back(dis(gen));
         }
 
-        ASSERT_NO_THROW([&list](){ delete list; }) << "List destructor should not throw";
+        ASSERT_NO_THROW([&list](){ delete list; }()) << "List destructor should not throw";
     }
 
     TEST(list_specializations, swap) {
@@ -542,4 +549,888 @@ namespace {
         ASSERT_TRUE(name.empty()) << "The moved from object should be empty";
 
     }
-}
\ No newline at end of file
+
+    TEST(list_order, precedes) {
+        saxion::list<int> lst;
+        std::vector<decltype(lst)::iterator> positions;
+
+        // keep inserting right after the first element, this exhausts the labels in the same gap over and over
+        auto first = lst.push_back(0);
+        for (int i = 1; i < 5000; ++i) {
+            auto next = first;
+            ++next;
+            lst.insert(next, i);
+        }
+        lst.push_front(-1);
+        for (auto it = lst.begin(); it != lst.end(); ++it) {
+            positions.push_back(it);
+        }
+
+        for (std::size_t i = 0; i + 1 < positions.size(); ++i) {
+            ASSERT_TRUE(lst.precedes(positions[i], positions[i + 1])) << "Order mismatch at index: " << i;
+            ASSERT_FALSE(lst.precedes(positions[i + 1], positions[i])) << "Order mismatch at index: " << i;
+        }
+        ASSERT_TRUE(lst.precedes(positions.front(), positions.back()));
+        ASSERT_TRUE(lst.precedes(positions.back(), lst.end())) << "Every element should precede end()";
+        ASSERT_FALSE(lst.precedes(lst.end(), lst.begin()));
+        ASSERT_FALSE(lst.precedes(lst.begin(), lst.begin()));
+
+        lst.erase(positions[10]);
+        ASSERT_TRUE(lst.precedes(positions[9], positions[11])) << "Erasing should keep the order of the rest";
+    }
+
+    TEST(list_order, approximate_distance) {
+        saxion::list<int> lst;
+        for (int i = 0; i < 1000; ++i) lst.push_back(i);
+
+        auto first = lst.begin();
+        auto middle = lst.begin();
+        for (int i = 0; i < 500; ++i) ++middle;
+
+        ASSERT_EQ(lst.approximate_distance(first, middle), 500) << "Evenly labelled lists give exact distances";
+        ASSERT_EQ(lst.approximate_distance(middle, first), -500);
+        ASSERT_EQ(lst.approximate_distance(first, lst.end()), 1000);
+    }
+
+    TEST(list_modifiers, reverse) {
+        saxion::list lst(names);
+        lst.reverse();
+        ASSERT_TRUE(lst.reversed());
+        ASSERT_EQ(lst.size(), names.size()) << "Reversing should not change the size";
+        ASSERT_EQ(lst.front(), *(names.end() - 1)) << "The front() of a reversed list should be the old back()";
+        ASSERT_EQ(lst.back(), *names.begin()) << "The back() of a reversed list should be the old front()";
+
+        auto name = names.end();
+        for (auto& element : lst) {
+            --name;
+            ASSERT_EQ(element, *name) << "A reversed list should iterate backwards";
+        }
+        for (std::size_t i = 0; i < lst.size(); ++i) {
+            ASSERT_EQ(lst[i], *(names.end() - 1 - i)) << "unexpected item at index: " << i;
+        }
+
+        lst.push_front("zack");
+        lst.push_back("aaron");
+        auto pos = lst.begin();
+        ++pos;
+        pos = lst.insert(pos, "yara");
+        ASSERT_EQ(*pos, "yara");
+        ASSERT_EQ(lst.front(), "zack");
+        ASSERT_EQ(lst[1], "yara") << "insert should place the element before pos in the reversed order";
+        ASSERT_EQ(lst[2], *(names.end() - 1));
+        ASSERT_EQ(lst.back(), "aaron");
+        ASSERT_TRUE(lst.precedes(lst.begin(), pos)) << "Order queries should follow the reversed order";
+
+        pos = lst.erase(pos);
+        ASSERT_EQ(*pos, *(names.end() - 1)) << "erase should return the next element in the reversed order";
+        lst.pop_front();
+        lst.pop_back();
+
+        auto copy(lst);
+        lst.normalize();
+        ASSERT_FALSE(lst.reversed());
+        ASSERT_EQ(lst.size(), names.size());
+        for (std::size_t i = 0; i < lst.size(); ++i) {
+            ASSERT_EQ(lst[i], copy[i]) << "normalize should keep the logical order, mismatch at index: " << i;
+        }
+        auto back = lst.end();
+        --back;
+        ASSERT_EQ(*back, *names.begin()) << "Stepping back from end() should reach the last element";
+        ASSERT_TRUE(lst.precedes(lst.begin(), back)) << "Labels should follow the normalized order";
+
+        lst.reverse();
+        lst.reverse();
+        ASSERT_EQ(lst.front(), *(names.end() - 1)) << "Reversing twice should restore the order";
+    }
+
+    template<typename _Policy>
+    void check_splice_and_split() {
+        saxion::list<std::string, _Policy> lst(names), other{"kate", "lars", "mary"};
+        auto first = lst.begin();
+        ++first;
+        auto last = first;
+        for (int i = 0; i < 3; ++i) ++last;
+        // move bob, cindy, eve between kate and lars
+        auto pos = other.begin();
+        ++pos;
+        other.splice(pos, lst, first, last);
+        ASSERT_EQ(lst.size(), names.size() - 3);
+        ASSERT_EQ(other.size(), 6);
+        std::vector<std::string> expected{"kate", "bob", "cindy", "eve", "lars", "mary"};
+        ASSERT_TRUE(std::equal(other.begin(), other.end(), expected.begin(), expected.end()));
+        ASSERT_EQ(lst[1], "felix") << "The source list should be closed over the moved range";
+        ASSERT_TRUE(other.precedes(other.begin(), pos)) << "Spliced nodes should be ordered after the splice";
+        ASSERT_TRUE(other.precedes(++other.begin(), pos));
+
+        // within the same list: move kate to the back
+        other.splice(other.end(), other, other.begin(), ++other.begin());
+        ASSERT_EQ(other.front(), "bob");
+        ASSERT_EQ(other.back(), "kate");
+        ASSERT_EQ(other.size(), 6);
+
+        auto tail = other.split_at(pos);
+        ASSERT_EQ(other.size(), 3);
+        ASSERT_EQ(other.back(), "eve");
+        ASSERT_EQ(tail.size(), 3);
+        ASSERT_EQ(tail.front(), "lars");
+        ASSERT_EQ(tail.back(), "kate");
+        auto back = tail.end();
+        --back;
+        ASSERT_EQ(*back, "kate") << "The split off list should have its own sentinel";
+
+        auto nothing = tail.split_at(tail.end());
+        ASSERT_TRUE(nothing.empty());
+        auto everything = tail.split_at(tail.begin());
+        ASSERT_TRUE(tail.empty());
+        ASSERT_EQ(everything.size(), 3);
+    }
+
+    TEST(list_modifiers, order_queries_after_split) {
+        saxion::list<int> lst{1, 2, 3, 4, 5};
+        auto rest = lst.split_at(std::next(lst.begin()));
+        auto a = rest.begin();
+        auto b = std::next(a, 2);
+        ASSERT_TRUE(rest.precedes(a, b)) << "The split off list should answer order queries";
+        ASSERT_FALSE(rest.precedes(b, a));
+        ASSERT_TRUE(rest.precedes(b, rest.end()));
+
+        saxion::list<int> other{7, 8, 9};
+        lst.splice(lst.end(), other);
+        auto spliced = lst.split_at(std::next(lst.begin()));
+        ASSERT_TRUE(spliced.precedes(spliced.begin(), std::next(spliced.begin())));
+        ASSERT_FALSE(spliced.precedes(std::next(spliced.begin(), 2), spliced.begin()));
+    }
+
+    TEST(list_modifiers, splice_split_eager) {
+        check_splice_and_split<saxion::eager_size>();
+    }
+
+    TEST(list_modifiers, splice_split_lazy) {
+        check_splice_and_split<saxion::lazy_size>();
+    }
+
+    TEST(list_modifiers, lazy_size_counts_once) {
+        saxion::list<int, saxion::lazy_size> lst, other;
+        for (int i = 0; i < 1000; ++i) lst.push_back(i);
+        other.splice(other.end(), lst, lst.begin(), lst.end());
+        other.push_back(1000);
+        ASSERT_TRUE(lst.empty());
+        ASSERT_EQ(other.size(), 1001) << "The size should be counted after a lazy splice";
+        other.pop_front();
+        ASSERT_EQ(other.size(), 1000) << "A counted size should be kept up to date again";
+        ASSERT_EQ(other.at(999), 1000);
+    }
+
+    TEST(list_modifiers, splice_reversed) {
+        saxion::list<int> lst{1, 2, 3}, other{4, 5, 6};
+        other.reverse();
+        lst.splice(lst.end(), other, other.begin(), other.end());
+        std::vector<int> expected{1, 2, 3, 6, 5, 4};
+        ASSERT_TRUE(std::equal(lst.begin(), lst.end(), expected.begin(), expected.end()));
+        ASSERT_TRUE(other.empty());
+    }
+
+    TEST(list_flat_view, copies_and_caches) {
+        saxion::list<int> lst;
+        for (int i = 0; i < 100; ++i) lst.push_back(i);
+        const auto& clst = lst;
+
+        auto view = clst.flat_view();
+        ASSERT_EQ(view.size(), 100);
+        ASSERT_TRUE((std::is_same_v<decltype(view.begin()), const int*>)) << "Small trivial values should be copied";
+        for (int i = 0; i < 100; ++i) {
+            ASSERT_EQ(view[i], i);
+        }
+        ASSERT_EQ(clst.flat_view().data(), view.data()) << "The view should be cached while the list doesn't change";
+
+        lst.push_front(-1);
+        auto rebuilt = clst.flat_view();
+        ASSERT_EQ(rebuilt.size(), 101) << "A modification should invalidate the cached view";
+        ASSERT_EQ(rebuilt[0], -1);
+
+        lst.front() = -2;
+        ASSERT_EQ(clst.flat_view()[0], -2) << "Handing out a mutable element should drop copied values";
+
+        lst.reverse();
+        ASSERT_EQ(clst.flat_view()[0], 99) << "The view should follow the list order";
+        lst.erase(lst.begin());
+        ASSERT_EQ(clst.flat_view()[0], 98);
+        lst.clear();
+        ASSERT_TRUE(clst.flat_view().empty());
+    }
+
+    TEST(list_flat_view, pointers) {
+        saxion::list lst(names);
+        const auto& clst = lst;
+        auto view = clst.flat_view();
+        ASSERT_EQ(view.size(), names.size());
+        ASSERT_TRUE(std::equal(view.begin(), view.end(), names.begin(), names.end()));
+        ASSERT_EQ(&view[2], &clst[2]) << "Other values should be referenced, not copied";
+        ASSERT_EQ(view.end() - view.begin(), static_cast<std::ptrdiff_t>(names.size()));
+        ASSERT_EQ(view.begin()[3], "eve");
+
+        lst.front() = "zack";
+        ASSERT_EQ(clst.flat_view()[0], "zack") << "A referenced value is seen through the view";
+
+        saxion::list<std::string> other{"kate"};
+        other.splice(other.end(), lst, lst.begin(), lst.end());
+        ASSERT_TRUE(clst.flat_view().empty()) << "A splice should invalidate the source view";
+        const auto& cother = other;
+        ASSERT_EQ(cother.flat_view().size(), names.size() + 1);
+        other.swap(lst);
+        ASSERT_EQ(clst.flat_view().size(), names.size() + 1);
+        ASSERT_TRUE(cother.flat_view().empty());
+    }
+
+    TEST(list_memory, retained_nodes_are_reused) {
+        saxion::list<int> lst;
+        lst.reserve(1000);
+        ASSERT_GE(lst.capacity(), 1000);
+        ASSERT_TRUE(lst.empty());
+
+        auto before = allocation_counter::allocations;
+        for (int frame = 0; frame < 10; ++frame) {
+            for (int i = 0; i < 1000; ++i) lst.push_back(i);
+            ASSERT_EQ(lst.size(), 1000);
+            ASSERT_EQ(lst.back(), 999);
+            lst.clear(saxion::clear_mode::retain);
+            ASSERT_TRUE(lst.empty());
+            ASSERT_EQ(lst.capacity(), 1000) << "clear_mode::retain should keep every node";
+        }
+        ASSERT_EQ(allocation_counter::allocations, before) << "Refilling retained nodes should not allocate";
+
+        for (int i = 0; i < 10; ++i) lst.push_front(i);
+        lst.clear();
+        ASSERT_EQ(lst.capacity(), 990) << "A plain clear should free the nodes, the reserve stays";
+        lst.shrink_to_fit();
+        ASSERT_EQ(lst.capacity(), 0);
+        lst.push_back(1);
+        ASSERT_EQ(allocation_counter::allocations, before + 1);
+    }
+
+    TEST(list_memory, retained_nodes_destroy_values) {
+        auto value = std::make_shared<int>(42);
+        saxion::list<std::shared_ptr<int>> lst;
+        for (int i = 0; i < 5; ++i) lst.push_back(value);
+        ASSERT_EQ(value.use_count(), 6);
+        lst.clear(saxion::clear_mode::retain);
+        ASSERT_EQ(value.use_count(), 1) << "A retained node should not keep its value alive";
+        lst.push_back(value);
+        ASSERT_EQ(*lst.front(), 42);
+
+        saxion::list<std::shared_ptr<int>> other;
+        other.swap(lst);
+        ASSERT_EQ(other.capacity(), 5) << "swap should exchange the retained nodes as well";
+        ASSERT_EQ(lst.capacity(), 0);
+    }
+
+    TEST(list_defragment, keeps_order_and_values) {
+        saxion::list<std::string> lst;
+        for (int i = 0; i < 100; ++i) lst.push_back(std::to_string(i));
+        // scatter the nodes a bit
+        for (auto it = lst.begin(); it != lst.end();) {
+            it = std::stoi(*it) % 3 == 0 ? lst.erase(it) : std::next(it);
+        }
+        for (int i = 0; i < 10; ++i) lst.insert(std::next(lst.begin(), i * 5), "x" + std::to_string(i));
+        std::vector<std::string> expected(lst.begin(), lst.end());
+
+        lst.defragment();
+        ASSERT_EQ(std::vector<std::string>(lst.begin(), lst.end()), expected);
+        ASSERT_EQ(lst.size(), expected.size());
+        std::vector<std::string> backwards;
+        for (auto it = lst.end(); it != lst.begin();) backwards.push_back(*--it);
+        ASSERT_EQ(backwards, std::vector<std::string>(expected.rbegin(), expected.rend()));
+        // the order queries still work
+        ASSERT_TRUE(lst.precedes(lst.begin(), std::prev(lst.end())));
+
+        // the nodes in the block are contiguous
+        for (auto it = lst.begin(); std::next(it) != lst.end(); ++it) {
+            ASSERT_EQ(reinterpret_cast<const char*>(&*std::next(it)) - reinterpret_cast<const char*>(&*it),
+                      static_cast<std::ptrdiff_t>(sizeof(saxion::detail::list_node_t<std::string>)));
+        }
+
+        saxion::list<std::string> empty;
+        empty.defragment();
+        ASSERT_TRUE(empty.empty());
+    }
+
+    TEST(list_defragment, remap_updates_held_iterators) {
+        saxion::list<int> lst;
+        for (int i = 0; i < 50; ++i) lst.push_front(i);
+        std::vector<saxion::list<int>::iterator> held;
+        for (auto it = lst.begin(); it != lst.end(); std::advance(it, 7)) {
+            held.push_back(it);
+            if (std::distance(it, lst.end()) <= 7) break;
+        }
+        std::vector<int> values;
+        for (auto it : held) values.push_back(*it);
+
+        std::size_t calls = 0;
+        lst.compact([&](saxion::list<int>::const_iterator from, saxion::list<int>::iterator to) {
+            ++calls;
+            for (auto& it : held) {
+                if (saxion::list<int>::const_iterator(it) == from) it = to;
+            }
+        });
+        ASSERT_EQ(calls, 50u);
+        for (std::size_t i = 0; i < held.size(); ++i) ASSERT_EQ(*held[i], values[i]);
+        *held[0] = -1;
+        ASSERT_EQ(lst.front(), -1);
+    }
+
+    TEST(list_defragment, edits_after_defragment) {
+        saxion::list<std::shared_ptr<int>> lst;
+        auto value = std::make_shared<int>(7);
+        for (int i = 0; i < 20; ++i) lst.push_back(value);
+        lst.defragment();
+        ASSERT_EQ(value.use_count(), 21) << "The old nodes should be gone, the values moved";
+
+        // a node of the block is erased and new nodes mix with the block
+        lst.erase(std::next(lst.begin(), 3));
+        lst.insert(std::next(lst.begin(), 5), value);
+        lst.push_front(value);
+        ASSERT_EQ(lst.size(), 21u);
+        // defragmenting twice moves the nodes out of the old block
+        lst.defragment();
+        ASSERT_EQ(value.use_count(), 22);
+
+        // nodes of the block spliced into another list outlive the list they came from
+        saxion::list<std::shared_ptr<int>> other;
+        {
+            saxion::list<std::shared_ptr<int>> moved;
+            moved.push_back(value);
+            moved.splice(moved.end(), lst, std::next(lst.begin(), 2), std::next(lst.begin(), 8));
+            saxion::list<std::shared_ptr<int>> rest = moved.split_at(std::next(moved.begin(), 3));
+            other.swap(rest);
+            lst.clear(saxion::clear_mode::retain);
+            ASSERT_EQ(lst.capacity(), 0) << "Nodes of a block can't be retained";
+        }
+        ASSERT_EQ(other.size(), 4u);
+        ASSERT_EQ(value.use_count(), 5);
+        other.clear();
+        ASSERT_EQ(value.use_count(), 1);
+    }
+
+    TEST(list_bulk, copy_builds_one_block) {
+        saxion::list<int> original;
+        for (int i = 0; i < 1000; ++i) original.push_front(i);
+
+        auto before = allocation_counter::allocations;
+        saxion::list<int> copy(original);
+        ASSERT_LE(allocation_counter::allocations - before, 3u) << "The copy should not allocate per node";
+        ASSERT_TRUE(std::equal(copy.begin(), copy.end(), original.begin(), original.end()));
+        ASSERT_TRUE(copy.precedes(copy.begin(), std::prev(copy.end())));
+
+        original.reverse();
+        copy = original;
+        ASSERT_EQ(copy.front(), 0) << "A copy should follow the order of a reversed list";
+        copy.erase(std::next(copy.begin(), 10));
+        copy.insert(std::next(copy.begin(), 20), -1);
+        ASSERT_EQ(copy.size(), 1000);
+
+        std::vector<std::string> values{"x", "y", "z"};
+        saxion::list<std::string> from_range(values.begin(), values.end());
+        saxion::list<std::string> from_init{"x", "y", "z"};
+        ASSERT_TRUE(std::equal(from_range.begin(), from_range.end(), from_init.begin(), from_init.end()));
+        from_init.push_back("w");
+        ASSERT_EQ(from_init.back(), "w");
+    }
+
+    TEST(list_range, insert_and_erase_ranges) {
+        saxion::list<int> lst{1, 2, 3};
+        std::vector<int> values{10, 11, 12};
+        auto it = lst.insert(std::next(lst.begin()), values.begin(), values.end());
+        ASSERT_EQ(*it, 10) << "insert should return the first inserted element";
+        ASSERT_EQ(std::vector<int>(lst.begin(), lst.end()), (std::vector<int>{1, 10, 11, 12, 2, 3}));
+        ASSERT_EQ(lst.size(), 6);
+        ASSERT_TRUE(lst.precedes(it, std::next(it)));
+        ASSERT_TRUE(lst.precedes(lst.begin(), it));
+        ASSERT_EQ(lst.insert(lst.begin(), values.end(), values.end()), lst.begin());
+
+        lst.append_range(values);
+        lst.insert(lst.end(), {7, 8});
+        ASSERT_EQ(lst.size(), 11);
+        ASSERT_EQ(lst.back(), 8);
+
+        auto next = lst.erase(std::next(lst.begin()), std::next(lst.begin(), 4));
+        ASSERT_EQ(*next, 2) << "erase should return the end of the erased range";
+        ASSERT_EQ(std::vector<int>(lst.begin(), lst.end()), (std::vector<int>{1, 2, 3, 10, 11, 12, 7, 8}));
+        lst.pop_front_n(2);
+        lst.pop_back_n(3);
+        ASSERT_EQ(std::vector<int>(lst.begin(), lst.end()), (std::vector<int>{3, 10, 11}));
+        ASSERT_EQ(lst.size(), 3);
+        lst.pop_back_n(10);
+        ASSERT_TRUE(lst.empty());
+        ASSERT_EQ(lst.size(), 0);
+    }
+
+    TEST(list_range, ranges_in_a_reversed_list) {
+        saxion::list<int> lst{1, 2, 3, 4};
+        lst.reverse();
+        std::vector<int> values{10, 11};
+        auto it = lst.insert(std::next(lst.begin()), values.begin(), values.end());
+        ASSERT_EQ(*it, 10);
+        ASSERT_EQ(std::vector<int>(lst.begin(), lst.end()), (std::vector<int>{4, 10, 11, 3, 2, 1}));
+        ASSERT_TRUE(lst.precedes(it, std::next(it)));
+        lst.erase(std::next(lst.begin(), 2), std::next(lst.begin(), 4));
+        ASSERT_EQ(std::vector<int>(lst.begin(), lst.end()), (std::vector<int>{4, 10, 2, 1}));
+        lst.pop_front_n(1);
+        lst.pop_back_n(1);
+        ASSERT_EQ(std::vector<int>(lst.begin(), lst.end()), (std::vector<int>{10, 2}));
+    }
+
+    TEST(list_range, assign_reuses_nodes) {
+        saxion::list<std::string> lst{"a", "b", "c", "d"};
+        std::vector<std::string> values{"w", "x", "y"};
+        auto before = allocation_counter::allocations;
+        lst.assign(values.begin(), values.end());
+        ASSERT_EQ(allocation_counter::allocations, before) << "A shorter assign should not allocate nodes";
+        ASSERT_EQ(std::vector<std::string>(lst.begin(), lst.end()), values);
+        lst.assign({"p", "q", "r", "s", "t"});
+        ASSERT_EQ(lst.size(), 5);
+        ASSERT_EQ(lst.back(), "t");
+    }
+
+    // throws when it is copied from a value of -1
+    struct picky {
+        int value;
+
+        picky(int v = 0) : value(v) {}
+
+        picky(const picky& other) : value(other.value) {
+            if (value == -1) throw std::runtime_error("copy failed");
+        }
+
+        picky& operator=(const picky&) = default;
+    };
+
+    TEST(list_range, failed_insert_leaves_the_list) {
+        saxion::list<picky> lst;
+        lst.push_back(picky(1));
+        lst.push_back(picky(2));
+        std::vector<picky> values{picky(3), picky(4), picky(5)};
+        values.back().value = -1;
+        ASSERT_THROW(lst.insert(lst.end(), values.begin(), values.end()), std::runtime_error);
+        ASSERT_EQ(lst.size(), 2);
+        ASSERT_EQ(lst.back().value, 2);
+    }
+
+    // counts how its instances come about
+    struct tally {
+        static inline int constructed = 0;
+        static inline int copied = 0;
+        static inline int moved = 0;
+
+        static void reset() { constructed = copied = moved = 0; }
+
+        int id;
+        std::string name;
+
+        tally() : id(0) { ++constructed; }
+
+        tally(int i, std::string n) : id(i), name(std::move(n)) { ++constructed; }
+
+        tally(const tally& other) : id(other.id), name(other.name) { ++copied; }
+
+        tally(tally&& other) noexcept : id(other.id), name(std::move(other.name)) { ++moved; }
+    };
+
+    // can only be constructed in its final place
+    struct pinned {
+        int value;
+
+        pinned() : value(0) {}
+
+        explicit pinned(int v) : value(v) {}
+
+        pinned(const pinned&) = delete;
+
+        pinned(pinned&&) = delete;
+    };
+
+    TEST(list_emplace, constructs_once_in_place) {
+        saxion::list<tally> lst;
+        tally::reset();
+        lst.emplace_back(1, "one");
+        lst.emplace_front(0, "zero");
+        lst.emplace(std::next(lst.begin()), 2, "two");
+        lst.reverse();
+        lst.emplace(lst.begin(), 3, "three");
+        ASSERT_EQ(tally::constructed, 4);
+        ASSERT_EQ(tally::copied, 0);
+        ASSERT_EQ(tally::moved, 0) << "emplace should not move a temporary into the node";
+
+        std::vector<int> ids;
+        for (const auto& t : lst) ids.push_back(t.id);
+        ASSERT_EQ(ids, (std::vector<int>{3, 1, 2, 0}));
+        ASSERT_EQ(lst.front().name, "three");
+    }
+
+    TEST(list_emplace, immovable_values) {
+        saxion::list<pinned> lst;
+        lst.emplace_back(1);
+        lst.emplace_front(0);
+        lst.emplace(lst.end(), 2);
+        int expected = 0;
+        for (const auto& p : lst) ASSERT_EQ(p.value, expected++);
+        lst.erase(lst.begin());
+        ASSERT_EQ(lst.front().value, 1);
+    }
+}
+
+namespace {
+    TEST(list_teardown, reserved_nodes_are_dropped_and_reused) {
+        saxion::list<int> lst;
+        lst.reserve(1000);
+        for (int i = 0; i < 1000; ++i) lst.push_back(i);
+        saxion::list<int> other;
+        other.splice(other.end(), lst, std::next(lst.begin(), 990), lst.end());
+        lst.clear(saxion::clear_mode::retain);
+        ASSERT_TRUE(lst.empty());
+        ASSERT_EQ(lst.capacity(), 0) << "A block that other holds nodes of can't be handed out again";
+
+        // the spliced nodes outlive the list they were built for
+        int expected = 990;
+        for (int v : other) ASSERT_EQ(v, expected++);
+        other.push_back(1000);
+        other.clear();
+        ASSERT_TRUE(other.empty());
+
+        lst.reserve(100);
+        for (int i = 0; i < 100; ++i) lst.push_back(i);
+        lst.clear(saxion::clear_mode::retain);
+        auto before = allocation_counter::allocations;
+        for (int i = 0; i < 100; ++i) lst.push_back(i);
+        ASSERT_EQ(allocation_counter::allocations, before) << "Clearing a block should hand its nodes out again";
+        ASSERT_EQ(lst.back(), 99);
+    }
+
+    TEST(list_teardown, values_with_a_destructor_are_destroyed) {
+        auto value = std::make_shared<int>(7);
+        saxion::list<std::shared_ptr<int>> lst;
+        lst.reserve(10);
+        for (int i = 0; i < 10; ++i) lst.push_back(value);
+        lst.clear();
+        ASSERT_EQ(value.use_count(), 1) << "clear should still destroy the values";
+
+        std::vector<std::shared_ptr<int>> values(5, value);
+        saxion::list<std::shared_ptr<int>> copied(values.begin(), values.end());
+        values.clear();
+        copied.push_back(value);
+        copied.clear();
+        ASSERT_EQ(value.use_count(), 1);
+    }
+
+    TEST(list_teardown, mixed_nodes) {
+        std::vector<int> ones(10, 1);
+        saxion::list<int> lst(ones.begin(), ones.end());
+        lst.push_back(2);
+        lst.push_front(0);
+        lst.erase(std::next(lst.begin()));
+        ASSERT_EQ(lst.size(), 11);
+        lst.clear();
+        ASSERT_TRUE(lst.empty());
+        lst.push_back(3);
+        ASSERT_EQ(lst.front(), 3);
+
+        std::vector<int> fives(100, 5);
+        saxion::list<int> bulk(fives.begin(), fives.end());
+        bulk.reverse();
+        bulk.pop_front();
+        bulk.clear(saxion::clear_mode::retain);
+        ASSERT_TRUE(bulk.empty());
+        bulk.push_back(6);
+        ASSERT_EQ(bulk.back(), 6);
+    }
+
+    TEST(list_teardown, clear_incremental) {
+        auto value = std::make_shared<int>(1);
+        saxion::list<std::shared_ptr<int>> lst;
+        for (int i = 0; i < 1000; ++i) lst.push_back(value);
+        int calls = 1;
+        while (!lst.clear_incremental(300)) {
+            ++calls;
+            ASSERT_EQ(value.use_count(), 1 + 1000 - 300 * (calls - 1));
+        }
+        ASSERT_EQ(calls, 4);
+        ASSERT_TRUE(lst.empty());
+        ASSERT_EQ(value.use_count(), 1);
+        ASSERT_TRUE(lst.clear_incremental(10)) << "An empty list is done at once";
+
+        saxion::list<int> ints;
+        ints.reserve(100);
+        for (int i = 0; i < 100; ++i) ints.push_back(i);
+        ASSERT_TRUE(ints.clear_incremental(1)) << "A block of ints is dropped as a whole";
+    }
+
+    // counts its destruction, a little late
+    struct slow_to_destroy {
+        std::atomic<int>* destroyed = nullptr;
+
+        ~slow_to_destroy() {
+            if (destroyed) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                ++*destroyed;
+            }
+        }
+    };
+
+    TEST(list_teardown, reclaimer_destructor_waits_for_the_queue) {
+        std::atomic<int> destroyed{0};
+        {
+            saxion::reclaimer reclaimer;
+            for (int i = 0; i < 20; ++i) {
+                auto item = std::make_unique<saxion::reclaimer::holder<slow_to_destroy>>();
+                item->value.destroyed = &destroyed;
+                reclaimer.post(std::move(item));
+            }
+        }
+        ASSERT_EQ(destroyed, 20) << "The reclaimer should destroy everything that was posted before it stops";
+
+        saxion::reclaimer unused;
+    }
+
+    TEST(list_teardown, detach_and_reclaim) {
+        auto value = std::make_shared<int>(1);
+        saxion::list<std::shared_ptr<int>> lst;
+        for (int i = 0; i < 1000; ++i) lst.push_back(value);
+        lst.detach_and_reclaim();
+        ASSERT_TRUE(lst.empty());
+        ASSERT_EQ(lst.size(), 0);
+        saxion::reclaimer::instance().flush();
+        ASSERT_EQ(value.use_count(), 1) << "The reclaimer should have destroyed the values";
+
+        lst.push_back(value);
+        lst.push_back(value);
+        ASSERT_EQ(lst.size(), 2);
+        ASSERT_EQ(*lst.front(), 1);
+        lst.detach_and_reclaim();
+        lst.detach_and_reclaim();
+        saxion::reclaimer::instance().flush();
+        ASSERT_EQ(value.use_count(), 1);
+    }
+}
+
+namespace {
+    template<typename _L>
+    std::vector<typename _L::value_type> values_of(const _L& lst) {
+        return std::vector<typename _L::value_type>(lst.begin(), lst.end());
+    }
+
+    TEST(list_splice, whole_single_and_range) {
+        saxion::list<int> lst{1, 2, 3};
+        saxion::list<int> other{10, 11, 12, 13};
+        lst.splice(std::next(lst.begin()), other);
+        ASSERT_TRUE(other.empty());
+        ASSERT_EQ(lst.size(), 7);
+        ASSERT_EQ(values_of(lst), (std::vector<int>{1, 10, 11, 12, 13, 2, 3}));
+
+        other.splice(other.end(), lst, std::next(lst.begin(), 2));
+        ASSERT_EQ(values_of(other), (std::vector<int>{11}));
+        ASSERT_EQ(lst.size(), 6);
+        lst.splice(lst.end(), lst, lst.begin());
+        ASSERT_EQ(values_of(lst), (std::vector<int>{10, 12, 13, 2, 3, 1}));
+        lst.splice(lst.begin(), lst, lst.begin());
+        ASSERT_EQ(lst.front(), 10) << "Splicing an element in front of itself does nothing";
+
+        other.splice(other.begin(), lst, std::next(lst.begin()), std::next(lst.begin(), 3));
+        ASSERT_EQ(values_of(other), (std::vector<int>{12, 13, 11}));
+        ASSERT_EQ(values_of(lst), (std::vector<int>{10, 2, 3, 1}));
+    }
+
+    TEST(list_splice, reversed_lists) {
+        saxion::list<int> lst{1, 2, 3};
+        saxion::list<int> other{4, 5, 6};
+        other.reverse();
+        auto six = other.begin();
+        lst.splice(lst.end(), other, six);
+        ASSERT_EQ(values_of(lst), (std::vector<int>{1, 2, 3, 6}));
+        lst.reverse();
+        lst.splice(lst.begin(), other);
+        ASSERT_EQ(values_of(lst), (std::vector<int>{5, 4, 6, 3, 2, 1}));
+        ASSERT_EQ(lst.size(), 6);
+        ASSERT_TRUE(other.empty());
+        other.push_back(7);
+        ASSERT_EQ(values_of(other), (std::vector<int>{7}));
+    }
+
+    TEST(list_sort, sorts_and_keeps_iterators) {
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<int> dist(0, 1000);
+        std::vector<int> expected;
+        saxion::list<int> lst;
+        for (int i = 0; i < 5000; ++i) {
+            int v = dist(gen);
+            expected.push_back(v);
+            lst.push_back(v);
+        }
+        auto first = lst.begin();
+        int first_value = *first;
+        lst.sort();
+        std::sort(expected.begin(), expected.end());
+        ASSERT_EQ(values_of(lst), expected);
+        ASSERT_EQ(*first, first_value) << "sort should relink the nodes, not move the values";
+        ASSERT_EQ(lst.size(), expected.size());
+
+        // the order queries and the links backwards still work
+        ASSERT_EQ(*std::prev(lst.end()), expected.back());
+        lst.insert(std::next(lst.begin()), -1);
+        ASSERT_EQ(*std::next(lst.begin()), -1);
+
+        lst.sort(std::greater<>());
+        std::sort(expected.begin(), expected.end(), std::greater<>());
+        expected.push_back(-1);
+        ASSERT_EQ(values_of(lst), expected);
+
+        saxion::list<int> empty;
+        empty.sort();
+        ASSERT_TRUE(empty.empty());
+        saxion::list<int> one{1};
+        one.sort();
+        ASSERT_EQ(values_of(one), (std::vector<int>{1}));
+    }
+
+    TEST(list_sort, stable_and_reversed) {
+        using entry = std::pair<int, int>;
+        saxion::list<entry> lst;
+        for (int i = 0; i < 1000; ++i) lst.push_front(entry{i % 7, i});
+        lst.reverse();
+        std::vector<entry> expected = values_of(lst);
+        auto by_key = [](const entry& a, const entry& b) { return a.first < b.first; };
+        lst.sort(by_key);
+        std::stable_sort(expected.begin(), expected.end(), by_key);
+        ASSERT_EQ(values_of(lst), expected);
+    }
+
+    TEST(list_sort, merge_is_stable) {
+        using entry = std::pair<int, char>;
+        auto by_key = [](const entry& a, const entry& b) { return a.first < b.first; };
+        saxion::list<entry> lst{entry{1, 'a'}, entry{3, 'a'}, entry{5, 'a'}};
+        saxion::list<entry> other{entry{5, 'b'}, entry{3, 'b'}, entry{0, 'b'}};
+        other.reverse();
+        lst.merge(other, by_key);
+        ASSERT_TRUE(other.empty());
+        ASSERT_EQ(lst.size(), 6);
+        ASSERT_EQ(values_of(lst), (std::vector<entry>{{0, 'b'}, {1, 'a'}, {3, 'a'}, {3, 'b'}, {5, 'a'}, {5, 'b'}}));
+
+        saxion::list<int> ints;
+        ints.merge(saxion::list<int>{1, 2});
+        ints.merge(saxion::list<int>{0, 3});
+        ASSERT_EQ(values_of(ints), (std::vector<int>{0, 1, 2, 3}));
+        ints.merge(ints);
+        ASSERT_EQ(ints.size(), 4);
+    }
+
+    TEST(list_sort, throwing_comparator_keeps_the_elements) {
+        saxion::list<int> lst;
+        for (int i = 0; i < 100; ++i) lst.push_back((i * 37) % 100);
+        int calls = 0;
+        auto throwing = [&calls](int a, int b) {
+            if (++calls == 300) throw std::runtime_error("comparison failed");
+            return a < b;
+        };
+        ASSERT_THROW(lst.sort(throwing), std::runtime_error);
+        ASSERT_EQ(lst.size(), 100);
+        std::vector<int> values = values_of(lst);
+        std::sort(values.begin(), values.end());
+        for (int i = 0; i < 100; ++i) ASSERT_EQ(values[i], i);
+        lst.sort();
+        ASSERT_EQ(lst.back(), 99);
+    }
+
+    TEST(list_relink, remove_if_and_remove) {
+        auto value = std::make_shared<int>(0);
+        saxion::list<std::shared_ptr<int>> shared;
+        for (int i = 0; i < 10; ++i) shared.push_back(i % 2 ? value : std::make_shared<int>(i));
+        ASSERT_EQ(shared.remove_if([&value](const std::shared_ptr<int>& p) { return p == value; }), 5);
+        ASSERT_EQ(value.use_count(), 1) << "The removed values should be destroyed";
+        ASSERT_EQ(shared.size(), 5);
+
+        saxion::list<int> lst{1, 2, 3, 2, 4, 2};
+        ASSERT_EQ(lst.remove(lst.front() + 1), 3);
+        ASSERT_EQ(values_of(lst), (std::vector<int>{1, 3, 4}));
+        // value refers to an element that is removed itself
+        ASSERT_EQ(lst.remove(lst.front()), 1);
+        ASSERT_EQ(values_of(lst), (std::vector<int>{3, 4}));
+        ASSERT_EQ(lst.remove(7), 0);
+        ASSERT_EQ(lst.remove_if([](int) { return true; }), 2);
+        ASSERT_TRUE(lst.empty());
+        lst.push_back(5);
+        ASSERT_EQ(lst.back(), 5);
+    }
+
+    TEST(list_relink, unique) {
+        saxion::list<int> lst{1, 1, 2, 2, 2, 3, 1, 1};
+        ASSERT_EQ(lst.unique(), 4);
+        ASSERT_EQ(values_of(lst), (std::vector<int>{1, 2, 3, 1}));
+        ASSERT_EQ(lst.size(), 4);
+        saxion::list<int> close{1, 2, 4, 5, 9};
+        ASSERT_EQ(close.unique([](int a, int b) { return b - a <= 1; }), 2);
+        ASSERT_EQ(values_of(close), (std::vector<int>{1, 4, 9}));
+        close.push_back(10);
+        ASSERT_EQ(close.back(), 10);
+    }
+
+    TEST(list_relink, reverse_and_partition) {
+        saxion::list<int> lst{1, 2, 3, 4, 5, 6, 7};
+        lst.reverse();
+        ASSERT_EQ(values_of(lst), (std::vector<int>{7, 6, 5, 4, 3, 2, 1}));
+        lst.push_back(0);
+        ASSERT_EQ(lst.back(), 0);
+        auto split = lst.stable_partition([](int v) { return v % 2 == 0; });
+        ASSERT_EQ(values_of(lst), (std::vector<int>{6, 4, 2, 0, 7, 5, 3, 1}));
+        ASSERT_EQ(*split, 7);
+        ASSERT_EQ(lst.size(), 8);
+        lst.push_back(9);
+        ASSERT_EQ(lst.back(), 9);
+        lst.partition([](int v) { return v > 100; });
+        ASSERT_EQ(lst.front(), 6);
+
+        int calls = 0;
+        auto throwing = [&calls](int v) {
+            if (++calls == 4) throw std::runtime_error("no answer");
+            return v % 2 == 1;
+        };
+        ASSERT_THROW(lst.stable_partition(throwing), std::runtime_error);
+        ASSERT_EQ(lst.size(), 9);
+        std::vector<int> values = values_of(lst);
+        std::sort(values.begin(), values.end());
+        ASSERT_EQ(values, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 9}));
+        lst.push_back(10);
+        ASSERT_EQ(lst.back(), 10);
+    }
+
+    TEST(list_partition_points, cuts_equal_ranges_in_order) {
+        saxion::list<int> lst;
+        for (int i = 0; i < 10; ++i) lst.push_back(i);
+        lst.reverse();
+        auto ranges = lst.partition_points(3);
+        ASSERT_EQ(ranges.size(), 3);
+        ASSERT_TRUE(ranges.front().first == lst.begin());
+        ASSERT_TRUE(ranges.back().second == lst.end());
+        std::vector<int> seen;
+        for (std::size_t i = 0; i < ranges.size(); ++i) {
+            if (i > 0) {
+                ASSERT_TRUE(ranges[i].first == ranges[i - 1].second) << "The ranges should touch";
+            }
+            auto length = std::distance(ranges[i].first, ranges[i].second);
+            ASSERT_TRUE(length == 3 || length == 4);
+            seen.insert(seen.end(), ranges[i].first, ranges[i].second);
+        }
+        ASSERT_EQ(seen, values_of(lst));
+
+        const saxion::list<int>& constant = lst;
+        auto many = constant.partition_points(25);
+        ASSERT_EQ(many.size(), 25);
+        std::size_t elements = 0;
+        for (const auto& range : many) elements += std::distance(range.first, range.second);
+        ASSERT_EQ(elements, 10);
+        ASSERT_TRUE(many.back().second == constant.end());
+        ASSERT_TRUE(lst.partition_points(0).empty());
+
+        saxion::list<int> empty;
+        auto none = empty.partition_points(2);
+        ASSERT_EQ(none.size(), 2);
+        ASSERT_TRUE(none[0].first == empty.end() && none[1].second == empty.end());
+    }
+}
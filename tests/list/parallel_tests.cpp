@@ -0,0 +1,175 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "parallel.h"
+
+namespace {
+    template<typename _L>
+    std::vector<typename _L::value_type> values_of(const _L& lst) {
+        return std::vector<typename _L::value_type>(lst.begin(), lst.end());
+    }
+
+    TEST(thread_pool, runs_every_task_once) {
+        saxion::thread_pool pool(4);
+        ASSERT_EQ(pool.size(), 4);
+        std::vector<std::atomic<int>> runs(1000);
+        for (int round = 0; round < 3; ++round) {
+            pool.run(runs.size(), [&runs](std::size_t i) { ++runs[i]; });
+        }
+        for (auto& count : runs) ASSERT_EQ(count, 3);
+    }
+
+    TEST(thread_pool, rethrows_after_all_tasks) {
+        saxion::thread_pool pool(3);
+        std::atomic<int> runs{0};
+        auto task = [&runs](std::size_t i) {
+            ++runs;
+            if (i == 5) throw std::runtime_error("task failed");
+        };
+        ASSERT_THROW(pool.run(20, task), std::runtime_error);
+        ASSERT_EQ(runs, 20) << "The other tasks should still run";
+        pool.run(2, [&runs](std::size_t) { ++runs; });
+        ASSERT_EQ(runs, 22);
+    }
+
+    TEST(parallel_sort, sorts_like_sort) {
+        using entry = std::pair<int, int>;
+        std::mt19937 gen(9);
+        std::uniform_int_distribution<int> dist(0, 1000);
+        saxion::list<entry> lst;
+        std::vector<entry> expected;
+        for (int i = 0; i < 100000; ++i) {
+            entry e{dist(gen), i};
+            lst.push_back(e);
+            expected.push_back(e);
+        }
+        lst.reverse();
+        std::reverse(expected.begin(), expected.end());
+        const entry* first = &lst.front();
+        auto by_key = [](const entry& a, const entry& b) { return a.first < b.first; };
+        saxion::parallel_sort(lst, by_key, 5);
+        std::stable_sort(expected.begin(), expected.end(), by_key);
+        ASSERT_EQ(values_of(lst), expected) << "parallel_sort should be stable";
+        ASSERT_EQ(lst.size(), expected.size());
+        ASSERT_TRUE(std::any_of(lst.begin(), lst.end(), [first](const entry& e) { return &e == first; }))
+                                    << "parallel_sort should relink the nodes, not move the values";
+        lst.push_back(entry{-1, -1});
+        lst.push_front(entry{-2, -2});
+        ASSERT_EQ(lst.back().first, -1);
+        ASSERT_EQ(lst.front().first, -2);
+
+        saxion::list<int> small{3, 1, 2};
+        saxion::parallel_sort(small);
+        ASSERT_EQ(values_of(small), (std::vector<int>{1, 2, 3}));
+    }
+
+    TEST(parallel_sort, throwing_comparator_keeps_the_elements) {
+        saxion::list<int> lst;
+        for (int i = 0; i < 70000; ++i) lst.push_back((i * 7919) % 70000);
+        std::atomic<int> calls{0};
+        auto throwing = [&calls](int a, int b) {
+            if (++calls == 100000) throw std::runtime_error("comparison failed");
+            return a < b;
+        };
+        ASSERT_THROW(saxion::parallel_sort(lst, throwing, 4), std::runtime_error);
+        ASSERT_EQ(lst.size(), 70000);
+        std::vector<int> values = values_of(lst);
+        std::sort(values.begin(), values.end());
+        for (int i = 0; i < 70000; ++i) ASSERT_EQ(values[i], i);
+    }
+
+    TEST(parallel_for_each, visits_every_element_once) {
+        saxion::list<int> lst;
+        for (int i = 0; i < 10000; ++i) lst.push_back(i);
+        lst.reverse();
+        saxion::parallel_for_each(lst, [](int& v) { v *= 2; }, 4);
+        std::vector<int> values = values_of(lst);
+        for (int i = 0; i < 10000; ++i) ASSERT_EQ(values[i], 2 * (9999 - i));
+
+        std::atomic<int> visits{0};
+        saxion::list<int> small{1, 2, 3};
+        saxion::parallel_for_each(small, [&visits](int& v) { visits += v; }, 8);
+        ASSERT_EQ(visits, 6);
+        saxion::list<int> empty;
+        saxion::parallel_for_each(empty, [&visits](int&) { ++visits; });
+        ASSERT_EQ(visits, 6);
+
+        auto throwing = [&visits](int& v) {
+            ++visits;
+            if (v == 500) throw std::runtime_error("bad element");
+        };
+        visits = 0;
+        ASSERT_THROW(saxion::parallel_for_each(lst, throwing, 4), std::runtime_error);
+        ASSERT_GT(visits, 9000) << "The other ranges should still be visited";
+        ASSERT_LT(visits, 10000) << "The rest of the throwing range is skipped";
+    }
+
+    TEST(parallel_transform_reduce, reduces_in_list_order) {
+        saxion::list<int> lst;
+        for (int i = 1; i <= 1000; ++i) lst.push_back(i);
+        auto square = [](int v) { return static_cast<long long>(v) * v; };
+        long long sum = saxion::parallel_transform_reduce(lst, 0LL, std::plus<>(), square, 4);
+        ASSERT_EQ(sum, 1000LL * 1001 * 2001 / 6);
+        ASSERT_EQ(saxion::parallel_transform_reduce(lst, 7LL, std::plus<>(), square), sum + 7);
+
+        // concatenation is associative but not commutative
+        saxion::list<std::string> words;
+        std::string expected = "start";
+        for (int i = 0; i < 300; ++i) {
+            words.push_back(std::to_string(i));
+            expected += std::to_string(i) + ",";
+        }
+        auto with_comma = [](const std::string& w) { return w + ","; };
+        for (std::size_t threads : {1u, 2u, 3u, 7u}) {
+            ASSERT_EQ(saxion::parallel_transform_reduce(words, std::string("start"), std::plus<>(), with_comma,
+                                                        threads), expected);
+        }
+        saxion::list<int> empty;
+        ASSERT_EQ(saxion::parallel_transform_reduce(empty, 5, std::plus<>(), [](int v) { return v; }, 4), 5);
+    }
+
+    TEST(parallel_build, keeps_the_input_order) {
+        std::vector<int> input(50000);
+        for (int i = 0; i < 50000; ++i) input[i] = i;
+        auto lst = saxion::parallel_build(input, [](int v) { return std::to_string(v); }, 4);
+        static_assert(std::is_same_v<decltype(lst), saxion::forward_list<std::string>>);
+        ASSERT_EQ(lst.size(), input.size());
+        int expected = 0;
+        for (const auto& value : lst) ASSERT_EQ(value, std::to_string(expected++));
+        ASSERT_EQ(lst.back(), "49999");
+        lst.push_back("tail");
+        ASSERT_EQ(lst.back(), "tail");
+        lst.push_front("head");
+        ASSERT_EQ(lst.size(), 50002);
+
+        // a forward range of a few elements, and an empty one
+        saxion::list<int> few{3, 1, 2};
+        auto doubled = saxion::parallel_build(few, [](int v) { return 2 * v; });
+        ASSERT_EQ(values_of(doubled), (std::vector<int>{6, 2, 4}));
+        auto none = saxion::parallel_build(std::vector<int>{}, [](int v) { return v; }, 3);
+        ASSERT_TRUE(none.empty());
+        none.push_back(1);
+        ASSERT_EQ(none.front(), 1);
+    }
+
+    TEST(parallel_build, rethrows_a_throwing_transform) {
+        std::vector<int> input(40000, 1);
+        input[30000] = 0;
+        auto inverse = [](int v) {
+            if (v == 0) throw std::domain_error("division by zero");
+            return 1.0 / v;
+        };
+        ASSERT_THROW(saxion::parallel_build(input, inverse, 4), std::domain_error);
+    }
+}
@@ -0,0 +1,153 @@
+//
+// Created by Saxion ACS.
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <string>
+
+#include "ring_list.h"
+
+namespace {
+    static auto names = {"alice", "bob", "cindy", "eve", "felix", "gina", "harold", "ilse", "jack"};
+
+    TEST(ring_list_constructors, capacity_ctor) {
+        saxion::ring_list<int> ring(4);
+        ASSERT_EQ(ring.size(), 0) << "A new ring should contain no elements.";
+        ASSERT_EQ(ring.capacity(), 4) << "The capacity should be the one passed to the constructor.";
+        ASSERT_TRUE(ring.empty()) << "A new ring should be empty";
+        ASSERT_TRUE(ring.begin() == ring.end()) << "begin() and end() of an empty ring should be equal";
+    }
+
+    TEST(ring_list_constructors, zero_capacity_throws) {
+        ASSERT_ANY_THROW(saxion::ring_list<int>(0)) << "A ring without nodes makes no sense and should throw.";
+    }
+
+    TEST(ring_list_constructors, copy_move) {
+        saxion::ring_list<std::string> ring(3);
+        for (auto name : names) ring.push_back(name);
+
+        auto copy(ring);
+        ASSERT_EQ(copy.size(), ring.size());
+        for (std::size_t i = 0; i < ring.size(); ++i) {
+            ASSERT_EQ(copy[i], ring[i]) << "unexpected item at index: " << i;
+        }
+
+        auto moved(std::move(copy));
+        ASSERT_EQ(moved.size(), 3);
+        ASSERT_EQ(moved.front(), "harold");
+        ASSERT_EQ(moved.back(), "jack");
+    }
+
+    TEST(ring_list_modifiers, push_back_below_capacity) {
+        saxion::ring_list<std::string> ring(names.size());
+        for (auto name : names) ring.push_back(name);
+
+        ASSERT_EQ(ring.size(), names.size());
+        ASSERT_TRUE(ring.full());
+        auto name = names.begin();
+        for (auto& value : ring) {
+            ASSERT_EQ(value, *name) << "Elements should be iterated from the oldest to the newest";
+            ++name;
+        }
+    }
+
+    TEST(ring_list_modifiers, push_back_overwrites_oldest) {
+        saxion::ring_list<std::string> ring(4);
+        for (auto name : names) {
+            ring.push_back(name);
+            ASSERT_LE(ring.size(), 4) << "The size of the ring should never exceed its capacity";
+        }
+
+        ASSERT_EQ(ring.size(), 4);
+        ASSERT_EQ(ring.front(), "gina") << "The oldest elements should have been overwritten";
+        ASSERT_EQ(ring.back(), "jack") << "The last element should be the most recently pushed one";
+
+        std::vector<std::string> expected(names.end() - 4, names.end());
+        std::size_t i = 0;
+        for (auto it = ring.cbegin(); it != ring.cend(); ++it, ++i) {
+            ASSERT_EQ(*it, expected[i]) << "unexpected item at index: " << i;
+        }
+        ASSERT_EQ(i, 4) << "A full ring should iterate over all its elements exactly once";
+    }
+
+    TEST(ring_list_modifiers, nodes_are_recycled) {
+        saxion::ring_list<int> ring(3);
+        std::vector<const int*> addresses;
+        for (int i = 0; i < 3; ++i) {
+            addresses.push_back(&*ring.push_back(i));
+        }
+        for (int i = 3; i < 9; ++i) {
+            auto pos = ring.push_back(i);
+            ASSERT_EQ(&*pos, addresses[i % 3]) << "push_back on a full ring should reuse the oldest node";
+        }
+    }
+
+    TEST(ring_list_modifiers, pop_front_and_clear) {
+        saxion::ring_list<int> ring(3);
+        ring.push_back(1);
+        ring.push_back(2);
+        ring.pop_front();
+        ASSERT_EQ(ring.size(), 1);
+        ASSERT_EQ(ring.front(), 2);
+
+        ring.push_back(3);
+        ring.push_back(4);
+        ring.push_back(5);
+        ASSERT_EQ(ring.size(), 3);
+        ASSERT_EQ(ring.front(), 3);
+        ASSERT_EQ(ring.back(), 5);
+
+        ring.clear();
+        ASSERT_TRUE(ring.empty());
+        ring.emplace_back(6);
+        ASSERT_EQ(ring.front(), 6);
+        ASSERT_EQ(ring.back(), 6);
+        ASSERT_ANY_THROW((void) ring.at(1)) << "Accessing ring element beyond its size should throw.";
+    }
+
+    TEST(ring_list_iterators, work_with_standard_algorithms) {
+        saxion::ring_list<int> ring(4);
+        for (int i = 1; i <= 6; ++i) ring.push_back(i);
+        ASSERT_EQ(std::distance(ring.begin(), ring.end()), 4);
+        ASSERT_EQ(std::vector<int>(ring.begin(), ring.end()), (std::vector<int>{3, 4, 5, 6}));
+        const auto& constant = ring;
+        ASSERT_EQ(std::count_if(constant.begin(), constant.end(), [](int v) { return v % 2 == 0; }), 2);
+        ASSERT_TRUE(std::find(ring.begin(), ring.end(), 5) != ring.end());
+    }
+
+    // a value whose assignment throws on request
+    struct fragile {
+        int value = 0;
+        bool breaks = false;
+
+        fragile() = default;
+
+        fragile(int v, bool b) : value(v), breaks(b) {}
+
+        fragile& operator=(const fragile& other) {
+            if (other.breaks) throw std::runtime_error("assignment failed");
+            value = other.value;
+            return *this;
+        }
+    };
+
+    TEST(ring_list_modifiers, throwing_push_back_keeps_the_ring) {
+        saxion::ring_list<fragile> ring(3);
+        ring.push_back(fragile(1, false));
+        ring.push_back(fragile(2, false));
+        ASSERT_THROW(ring.push_back(fragile(3, true)), std::runtime_error);
+        ASSERT_EQ(ring.size(), 2) << "A failed push_back should not grow the ring";
+        ASSERT_EQ(ring.back().value, 2);
+        ring.push_back(fragile(3, false));
+        ASSERT_THROW(ring.push_back(fragile(4, true)), std::runtime_error);
+        ASSERT_EQ(ring.size(), 3);
+        ASSERT_EQ(ring.front().value, 1) << "A failed push_back on a full ring should keep the oldest element";
+        ASSERT_EQ(ring.back().value, 3);
+        ASSERT_THROW(ring.emplace_back(5, true), std::runtime_error);
+        ASSERT_EQ(ring.front().value, 1);
+    }
+}